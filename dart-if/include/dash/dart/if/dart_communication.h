@@ -188,6 +188,33 @@ dart_ret_t dart_allreduce(
   dart_operation_t op,
   dart_team_t      team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI exscan.
+ *
+ * Every unit receives the reduction of the values sent by the units with
+ * smaller ids in the team. The content of \c recvbuf is undefined at
+ * unit 0.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team The team to participate in the exscan.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI alltoall.
  *
@@ -858,6 +885,73 @@ dart_ret_t dart_sendrecv(
   int                  recv_tag,
   dart_global_unit_t   src) DART_NOTHROW;
 
+/** \} */
+
+
+/**
+ * \name Non-blocking two-sided communication operations
+ * These operations return immediately, the handle can be used to wait for
+ * or test the completion of the operation using \c dart_wait,
+ * \c dart_waitall, \c dart_test, \c dart_testall and their \c _local
+ * variants.
+ */
+
+/** \{ */
+
+/**
+ * Non-blocking variant of \ref dart_send.
+ * The buffer \c sendbuf must not be modified before the operation
+ * completed.
+ *
+ * \param sendbuf Buffer containing the data to be sent by the unit.
+ * \param nelem   Number of values sent to the specified unit.
+ * \param dtype   The data type of values in \c sendbuf.
+ * \param tag     Message tag for the distinction between different messages.
+ * \param unit    Unit the message is sent to.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_waitall etc.
+ *                    Set to \c DART_HANDLE_NULL if the operation completed
+ *                    immediately.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_isend(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \ref dart_recv.
+ * The content of \c recvbuf is undefined before the operation completed.
+ *
+ * \param recvbuf Buffer for the incoming data.
+ * \param nelem   Number of values received by the unit
+ * \param dtype   The data type of values in \c recvbuf.
+ * \param tag     Message tag for the distinction between different messages.
+ * \param unit    Unit sending the message.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_waitall etc.
+ *                    Set to \c DART_HANDLE_NULL if the operation completed
+ *                    immediately.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_irecv(
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handle) DART_NOTHROW;
 
 /** \} */
 
@@ -166,6 +166,147 @@ dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t    gptr,
         void        ** addr) DART_NOTHROW;
 
+/** \cond DART_HIDDEN_SYMBOLS */
+
+/**
+ * Capacity of the table of segment base addresses published by the
+ * DART implementation.
+ */
+#define DART_SEGMENT_ADDR_TAB_SIZE 256
+
+/**
+ * Base addresses of a segment at the calling unit and at units in its
+ * shared memory node, published by the DART implementation to resolve
+ * native addresses of global pointers in inline functions.
+ */
+typedef struct
+{
+  /** Update counter, odd while the entry is being modified. */
+  uint32_t                 version;
+  /** The team associated with the segment. */
+  int16_t                  teamid;
+  /** The segment ID. */
+  int16_t                  segid;
+  /** ID of the calling unit relative to the segment's team. */
+  dart_unit_t              myid;
+  /** Base address of the segment at the calling unit. */
+  char                   * selfbaseptr;
+  /** Base addresses at all units in the calling unit's shared memory node,
+   *  \c NULL if the segment is not accessible in shared memory. */
+  char                  ** baseptr;
+  /** Node-local IDs of the team's units, negative for remote units. */
+  const dart_team_unit_t * sharedmem_tab;
+} dart_segment_addr_t;
+
+extern dart_segment_addr_t
+dart__segment_addr_tab[DART_SEGMENT_ADDR_TAB_SIZE];
+
+DART_INLINE
+int dart__segment_addr_slot(
+  int16_t teamid,
+  int16_t segid)
+{
+  return ((uint16_t)(teamid) * 61 + (uint16_t)(segid))
+         % DART_SEGMENT_ADDR_TAB_SIZE;
+}
+
+/**
+ * Native address of the memory referenced by \c gptr resolved from the
+ * published segment base addresses, \c NULL if the segment has not been
+ * published or the referenced unit is neither the calling unit nor, if
+ * \c node_local is set, a unit in the calling unit's shared memory node.
+ */
+DART_INLINE
+char * dart__segment_addr_lookup(
+  const dart_gptr_t * gptr,
+  int                 node_local)
+{
+#if defined(__GNUC__)
+  const dart_segment_addr_t * entry =
+    &dart__segment_addr_tab[
+      dart__segment_addr_slot(gptr->teamid, gptr->segid)];
+  uint32_t version = __atomic_load_n(&entry->version, __ATOMIC_ACQUIRE);
+  char *   baseptr = NULL;
+  if ((version & 1) != 0 ||
+      entry->teamid      != gptr->teamid ||
+      entry->segid       != gptr->segid  ||
+      entry->selfbaseptr == NULL) {
+    return NULL;
+  }
+  if (entry->myid == gptr->unitid) {
+    baseptr = entry->selfbaseptr;
+  } else if (node_local && entry->baseptr != NULL) {
+    int node_unit = entry->sharedmem_tab[gptr->unitid].id;
+    if (node_unit >= 0) {
+      baseptr = entry->baseptr[node_unit];
+    }
+  }
+  /* Discard the result if the entry has been modified concurrently: */
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  if (baseptr == NULL ||
+      __atomic_load_n(&entry->version, __ATOMIC_RELAXED) != version) {
+    return NULL;
+  }
+  return baseptr + gptr->addr_or_offs.offset;
+#else
+  (void)gptr;
+  (void)node_local;
+  return NULL;
+#endif
+}
+
+/** \endcond */
+
+/**
+ * Inline variant of \ref dart_gptr_getaddr.
+ *
+ * Addresses in segments at the calling unit are resolved without calling
+ * into the DART library, other global pointers are resolved by
+ * \ref dart_gptr_getaddr.
+ *
+ * \param      gptr Global pointer
+ * \param[out] addr Pointer to a pointer that will hold the local
+ *                  address if the \c gptr points to a local memory element.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+DART_INLINE DART_NOTHROW
+dart_ret_t dart_gptr_getaddr_fast(
+  const dart_gptr_t    gptr,
+        void        ** addr)
+{
+  char * local_addr = dart__segment_addr_lookup(&gptr, 0);
+  if (local_addr != NULL) {
+    *addr = local_addr;
+    return DART_OK;
+  }
+  return dart_gptr_getaddr(gptr, addr);
+}
+
+/**
+ * Get the native address of the memory element referenced by \c gptr if
+ * it can be accessed with plain loads and stores, i.e. if it is located
+ * at the calling unit or in a collective allocation at a unit in the
+ * calling unit's shared memory node.
+ *
+ * \param      gptr Global pointer
+ *
+ * \return The native address of the referenced element, or \c NULL if
+ *         the element must be accessed using one-sided communication.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+DART_INLINE DART_NOTHROW
+void * dart_gptr_getaddr_direct(
+  const dart_gptr_t    gptr)
+{
+  return dart__segment_addr_lookup(&gptr, 1);
+}
+
 /**
  * Set the local memory address for the specified global pointer such
  * the the specified address.
@@ -258,6 +399,53 @@ dart_ret_t dart_gptr_setflags(
   dart_gptr_t * gptr,
   uint16_t      flags) DART_NOTHROW;
 
+/**
+ * Placement policies for pages of local memory in the NUMA domains of a
+ * node.
+ *
+ * \see dart_mem_place
+ *
+ * \ingroup DartGlobMem
+ */
+typedef enum {
+  /** Keep the placement of the operating system, i.e. first touch. */
+  DART_MEM_PLACE_DEFAULT = 0,
+  /** Place pages in the NUMA domain of the calling unit or thread. */
+  DART_MEM_PLACE_LOCAL,
+  /** Interleave pages across all NUMA domains available to the unit. */
+  DART_MEM_PLACE_INTERLEAVED,
+  /** Place pages in a specified NUMA domain. */
+  DART_MEM_PLACE_BIND
+} dart_mem_placement_t;
+
+/**
+ * Place the pages of the local memory range [\c addr, \c addr + \c nbytes)
+ * in NUMA domains according to the specified placement policy.
+ * Pages that have already been touched are migrated. Only pages that are
+ * completely contained in the memory range are affected.
+ *
+ * The placement is a hint: if NUMA support is not available or pages
+ * cannot be migrated, the placement remains unchanged.
+ *
+ * \param addr      Begin of the local memory range, e.g. obtained from
+ *                  \ref dart_gptr_getaddr on a collective allocation.
+ * \param nbytes    Size of the memory range in bytes.
+ * \param placement The placement policy to apply.
+ * \param numa_id   NUMA domain for \c DART_MEM_PLACE_BIND, ignored
+ *                  otherwise.
+ *
+ * \return \c DART_OK on success, \c DART_ERR_INVAL if \c numa_id is not
+ *         a valid NUMA domain, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_mem_place(
+  void                 * addr,
+  size_t                 nbytes,
+  dart_mem_placement_t   placement,
+  int                    numa_id) DART_NOTHROW;
+
 /**
  * DART allocator used for non-collective global memory allocations using
  * \ref dart_allocator_alloc similar to \ref dart_memalloc.
@@ -469,6 +657,13 @@ dart_ret_t dart_team_memregister_aligned(
  * the user.
  * Does not perform any memory allocation.
  *
+ * The memory is detached when it is deregistered using
+ * \ref dart_team_memderegister, see
+ * \ref dart_team_memregister_persistent for buffers that are registered
+ * repeatedly. Unused persistent registrations overlapping the memory are
+ * detached first, the registration fails with \c DART_ERR_INVAL if the
+ * memory overlaps a persistent registration in use.
+ *
  * \param teamid  The team to participate in the collective operation.
  * \param nlelem  The number of local elements allocated in \c addr to
  *                attach.
@@ -493,18 +688,82 @@ dart_ret_t dart_team_memregister(
  * externally allocated memory.
  * Does not de-allocate memory.
  *
+ * Registrations created by \ref dart_team_memregister_persistent remain
+ * attached and cached until the registration cache exceeds its capacity or
+ * is flushed using \ref dart_team_memregister_flush.
+ *
  * \param gptr   Pointer to a global pointer object to set up.
  *
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
  *
  * \see dart_team_memregister
  * \see dart_team_memregister_aligned
+ * \see dart_team_memregister_persistent
  *
  * \threadsafe_none
  * \ingroup DartGlobMem
  */
 dart_ret_t dart_team_memderegister(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Collective function similar to \ref dart_team_memregister for memory
+ * that is registered repeatedly, e.g. staging buffers of an exchange
+ * phase. The memory remains attached after it has been deregistered and is
+ * cached per team, keyed by the local address range.
+ *
+ * If all units register a range that is still cached, the call yields the
+ * global pointer of the cached registration and only reduces a few
+ * integers across the team to agree on the cache hit. While a range is
+ * cached, it must stay valid. If the range of some unit misses the cache
+ * or overlaps a cached range, unused cached registrations are detached at
+ * all units and the range is registered anew. The registration fails with
+ * \c DART_ERR_INVAL at all units if a range overlaps a cached registration
+ * that is still in use.
+ *
+ * Unused registrations are detached in LRU order once more than
+ * \c DART_REGCACHE_SIZE of them are cached or they keep more than
+ * \c DART_REGCACHE_BYTES bytes attached at any unit (environment
+ * variables, defaults 16 and 256 MiB). A cache size of \c 0 disables
+ * caching.
+ *
+ * \param teamid  The team to participate in the collective operation.
+ * \param nlelem  The number of local elements allocated in \c addr to
+ *                attach.
+ * \param dtype   The data type of elements in \c addr.
+ * \param addr    Pointer to pre-allocated memory to be registered.
+ * \param gptr    Pointer to a global pointer object to set up.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \see dart_team_memregister_flush
+ *
+ * \threadsafe_none
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_team_memregister_persistent(
+  dart_team_t       teamid,
+  size_t            nlelem,
+  dart_datatype_t   dtype,
+  void            * addr,
+  dart_gptr_t     * gptr) DART_NOTHROW;
+
+/**
+ * Collective function, detaches all persistent registrations of the team
+ * that are no longer in use. Their memory may be released afterwards.
+ * Synchronizes the units of the team before detaching, all units detach
+ * the same registrations.
+ *
+ * \param teamid  The team to participate in the collective operation.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \see dart_team_memregister_persistent
+ *
+ * \threadsafe_none
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_team_memregister_flush(dart_team_t teamid) DART_NOTHROW;
+
 
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
@@ -29,6 +29,15 @@ extern "C" {
 /**
  * Initialize information of the specified team.
  *
+ * Locality information of a team is otherwise created on the first query
+ * of the team's locality. Does nothing if the team's locality information
+ * already exists.
+ *
+ * \note
+ * This is a collective operation on the team, the locality records of
+ * the team's units are exchanged if the team's locality information does
+ * not exist yet.
+ *
  * \threadsafe_none
  * \ingroup DartLocality
  */
@@ -47,6 +56,12 @@ dart_ret_t dart_team_locality_finalize(
 /**
  * Locality information of the team domain with the specified id tag.
  *
+ * \note
+ * Locality information of a team is created on the first query, which
+ * then is a collective operation on the team. Call
+ * \c dart_team_locality_init at all units in the team before querying
+ * at a subset of its units.
+ *
  * \threadsafe
  * \ingroup DartLocality
  */
@@ -222,6 +237,12 @@ dart_ret_t dart_domain_group(
 /**
  * Locality information of the unit with the specified team-relative id.
  *
+ * \note
+ * Locality information of a team is created on the first query, which
+ * then is a collective operation on the team. Call
+ * \c dart_team_locality_init at all units in the team before querying
+ * at a subset of its units.
+ *
  * \threadsafe
  * \ingroup DartLocality
  */
@@ -230,6 +251,18 @@ dart_ret_t dart_unit_locality(
   dart_team_unit_t                unit,
   dart_unit_locality_t         ** loc)                  DART_NOTHROW;
 
+/**
+ * Hardware locality information of the calling unit.
+ *
+ * In contrast to \c dart_unit_locality, this is a local operation and
+ * does not require the locality information of a team.
+ *
+ * \threadsafe_none
+ * \ingroup DartLocality
+ */
+dart_ret_t dart_unit_hwinfo(
+  const dart_hwinfo_t          ** hwinfo)               DART_NOTHROW;
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
@@ -46,8 +46,15 @@ dart_host_topology_t;
  * in the array contains the host name of unit j.
  */
 dart_ret_t dart__base__host_topology__create(
-  dart_unit_mapping_t   * unit_mapping,
-  dart_host_topology_t ** topo);
+  dart_unit_mapping_t               * unit_mapping,
+  const dart_unit_locality_record_t * records,
+  dart_host_topology_t             ** topo);
+
+/* Resolves locations of modules like Xeon Phi coprocessors attached to
+ * the calling unit's node, requires hwloc with PCI device support. */
+dart_ret_t dart__base__host_topology__module_locations(
+  dart_module_location_t ** module_locations,
+  int                     * num_modules);
 
 dart_ret_t dart__base__host_topology__destruct(
   dart_host_topology_t  * topo);
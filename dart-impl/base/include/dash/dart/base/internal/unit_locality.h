@@ -13,9 +13,29 @@ typedef struct
   dart_team_t             team;
 } dart_unit_mapping_t;
 
+/**
+ * Locality information of a single unit that is exchanged when the
+ * locality of a team is created.
+ * Module locations are exchanged separately as their number is not
+ * bounded, \c modules only refers to local memory.
+ */
+typedef struct
+{
+  dart_hwinfo_t            hwinfo;
+  int                      num_modules;
+  dart_module_location_t * modules;
+} dart_unit_locality_record_t;
+
+dart_ret_t dart__base__unit_locality__record_init(
+  dart_unit_locality_record_t * record);
+
+dart_ret_t dart__base__unit_locality__record_fini(
+  dart_unit_locality_record_t * record);
+
 dart_ret_t dart__base__unit_locality__create(
-  dart_team_t             team,
-  dart_unit_mapping_t  ** unit_mapping);
+  dart_team_t                         team,
+  const dart_unit_locality_record_t * records,
+  dart_unit_mapping_t              ** unit_mapping);
 
 dart_ret_t dart__base__unit_locality__destruct(
   dart_unit_mapping_t   * unit_mapping);
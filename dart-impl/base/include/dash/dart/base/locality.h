@@ -197,4 +197,12 @@ dart_ret_t dart__base__locality__unit(
   dart_team_unit_t                   unit,
   dart_unit_locality_t            ** locality);
 
+/**
+ * Hardware locality of the calling unit.
+ *
+ * Resolved once on first call and cached, does not communicate.
+ */
+dart_ret_t dart__base__locality__local_hwinfo(
+  const dart_hwinfo_t             ** hwinfo);
+
 #endif /* DART__BASE__LOCALITY_H__ */
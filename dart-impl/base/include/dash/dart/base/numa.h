@@ -0,0 +1,30 @@
+/**
+ * \file dash/dart/base/numa.h
+ *
+ * Placement of local memory in NUMA domains, independent from a concrete
+ * implementation of the DART interface.
+ */
+#ifndef DART__BASE__NUMA_H__
+#define DART__BASE__NUMA_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <stddef.h>
+
+/**
+ * Apply the NUMA placement policy \c placement to the pages in the
+ * local memory range [\c addr, \c addr + \c nbytes).
+ * Pages that have already been touched are migrated.
+ *
+ * Only pages that are completely contained in the memory range are
+ * affected.
+ * Without libnuma support, the placement is not changed.
+ */
+dart_ret_t dart__base__numa__place(
+  void                 * addr,
+  size_t                 nbytes,
+  dart_mem_placement_t   placement,
+  int                    numa_id);
+
+#endif /* DART__BASE__NUMA_H__ */
@@ -54,81 +54,109 @@
 dart_ret_t dart__base__unit_locality__init(
   dart_unit_locality_t  * loc);
 
-dart_ret_t dart__base__unit_locality__local_unit_new(
-  dart_team_t             team,
-  dart_unit_locality_t  * loc);
-
 /* ======================================================================== *
  * Init / Finalize                                                          *
  * ======================================================================== */
 
 /**
- * Exchange and collect all locality information of all units in the
- * specified team in an array of \c dart_unit_mapping_t objects.
+ * Initialize the locality record of the calling unit from its hardware
+ * locality and the locations of modules attached to its node.
+ */
+dart_ret_t dart__base__unit_locality__record_init(
+  dart_unit_locality_record_t * record)
+{
+  DART_LOG_DEBUG("dart__base__unit_locality__record_init()");
+  if (record == NULL) {
+    DART_LOG_ERROR("dart__base__unit_locality__record_init ! null");
+    return DART_ERR_INVAL;
+  }
+  memset(record, 0, sizeof(dart_unit_locality_record_t));
+
+  /* Hardware locality does not depend on the team, it is only resolved
+   * once per unit: */
+  const dart_hwinfo_t * hwinfo;
+  DART_ASSERT_RETURNS(
+    dart__base__locality__local_hwinfo(&hwinfo),
+    DART_OK);
+  record->hwinfo = *hwinfo;
+
+#if defined(DART__BASE__LOCALITY__SIMULATE_MICS)
+  /* Assigns every second unit to a MIC host name.
+   * Useful for simulating a heterogeneous node-level topology
+   * for debugging.
+   */
+  dart_global_unit_t myid;
+  DART_ASSERT_RETURNS(dart_myid(&myid), DART_OK);
+  if (myid.id % 3 == 1) {
+    strncat(record->hwinfo.host, "-mic0", 5);
+  }
+#endif
+
+  DART_ASSERT_RETURNS(
+    dart__base__host_topology__module_locations(
+      &record->modules, &record->num_modules),
+    DART_OK);
+
+  DART_LOG_DEBUG("dart__base__unit_locality__record_init > "
+                 "host:'%s' core_id:%d numa_id:%d nthreads:%d modules:%d",
+                 record->hwinfo.host,
+                 record->hwinfo.cpu_id, record->hwinfo.numa_id,
+                 record->hwinfo.max_threads, record->num_modules);
+  return DART_OK;
+}
+
+/**
+ * Release the module locations of a locality record initialized by
+ * \c dart__base__unit_locality__record_init.
+ */
+dart_ret_t dart__base__unit_locality__record_fini(
+  dart_unit_locality_record_t * record)
+{
+  if (record == NULL) {
+    return DART_ERR_INVAL;
+  }
+  free(record->modules);
+  record->modules     = NULL;
+  record->num_modules = 0;
+  return DART_OK;
+}
+
+/**
+ * Collect locality information of all units in the specified team in an
+ * array of \c dart_unit_mapping_t objects from the units' locality
+ * records, ordered by unit id relative to the team.
  *
  * Note that locality information does not contain the units' locality
  * domain tags.
  *
  * \note
- * This is a collective N-to-N (allgather) operation.
+ * This is a local operation, the records have to be exchanged by the
+ * caller.
  */
 dart_ret_t dart__base__unit_locality__create(
-  dart_team_t             team,
-  dart_unit_mapping_t  ** unit_mapping)
+  dart_team_t                         team,
+  const dart_unit_locality_record_t * records,
+  dart_unit_mapping_t              ** unit_mapping)
 {
-  dart_ret_t  ret;
-  dart_team_unit_t myid = DART_UNDEFINED_TEAM_UNIT_ID;
-  size_t      nunits = 0;
-  *unit_mapping      = NULL;
+  size_t nunits = 0;
+  *unit_mapping = NULL;
   DART_LOG_DEBUG("dart__base__unit_locality__create()");
 
-  DART_ASSERT_RETURNS(dart_team_myid(team, &myid),   DART_OK);
   DART_ASSERT_RETURNS(dart_team_size(team, &nunits), DART_OK);
 
-  size_t nbytes = sizeof(dart_unit_locality_t);
-
-  /* get local unit's locality information: */
-  dart_unit_locality_t * uloc = malloc(sizeof(dart_unit_locality_t));
-  ret  = dart__base__unit_locality__local_unit_new(team, uloc);
-  if (ret != DART_OK) {
-    DART_LOG_ERROR("dart__base__unit_locality__create ! "
-                   "dart__base__unit_locality__local_unit_new failed: %d",
-                   ret);
-    free(uloc);
-    return ret;
-  }
-  DART_LOG_TRACE("dart__base__unit_locality__create: unit %d of %ld: "
-                 "sending %ld bytes: "
-                 "host:'%s' core_id:%d numa_id:%d nthreads:%d",
-                 myid.id, nunits, nbytes,
-                 uloc->hwinfo.host,
-                 uloc->hwinfo.cpu_id, uloc->hwinfo.numa_id,
-                 uloc->hwinfo.max_threads);
-
   dart_unit_mapping_t * mapping = malloc(sizeof(dart_unit_mapping_t));
   mapping->num_units            = nunits;
   mapping->team                 = team;
   mapping->unit_localities      = malloc(nunits *
                                           sizeof(dart_unit_locality_t));
-  dart_barrier(team);
-
-  /* all-to-all exchange of locality data across all units:
-   * (send, recv, nbytes, team) */
-  DART_LOG_DEBUG("dart__base__unit_locality__create: dart_allgather");
-  ret = dart_allgather(uloc,
-                       mapping->unit_localities,
-                       nbytes,
-                       DART_TYPE_BYTE,
-                       team);
-
-  dart_barrier(team);
-  free(uloc);
-
-  if (ret != DART_OK) {
-    DART_LOG_ERROR("dart__base__unit_locality__create ! "
-                   "dart_allgather failed: %d", ret);
-    free(mapping);
-    return ret;
+  for (size_t u = 0; u < nunits; ++u) {
+    dart_unit_locality_t * uloc = &mapping->unit_localities[u];
+    DART_ASSERT_RETURNS(
+      dart__base__unit_locality__init(uloc),
+      DART_OK);
+    uloc->unit.id = u;
+    uloc->team    = team;
+    uloc->hwinfo  = records[u].hwinfo;
   }
 #ifdef DART_ENABLE_LOGGING
   for (size_t u = 0; u < nunits; ++u) {
@@ -198,58 +226,6 @@ dart_ret_t dart__base__unit_locality__at(
  * Private Functions                                                        *
  * ======================================================================== */
 
-/**
- * Initialize unit locality information from HW locality.
- */
-dart_ret_t dart__base__unit_locality__local_unit_new(
-  dart_team_t             team,
-  dart_unit_locality_t  * uloc)
-{
-  DART_LOG_DEBUG("dart__base__unit_locality__local_unit_new() loc(%p)",
-                 (void *)uloc);
-  if (uloc == NULL) {
-    DART_LOG_ERROR("dart__base__unit_locality__local_unit_new ! null");
-    return DART_ERR_INVAL;
-  }
-  dart_team_unit_t myid;
-
-  DART_ASSERT_RETURNS(
-    dart__base__unit_locality__init(uloc),
-    DART_OK);
-  DART_ASSERT_RETURNS(
-    dart_team_myid(team, &myid),
-    DART_OK);
-
-  dart_hwinfo_t hwinfo;
-  DART_ASSERT_RETURNS(dart_hwinfo(&hwinfo), DART_OK);
-
-#if 1 || __TODO__CLARIFY__
-  /* Is this call required? */
-  dart_domain_locality_t * tloc;
-  DART_ASSERT_RETURNS(
-    dart_domain_team_locality(team, ".", &tloc),
-    DART_OK);
-#endif
-
-  uloc->unit   = myid;
-  uloc->team   = team;
-  uloc->hwinfo = hwinfo;
-
-#if defined(DART__BASE__LOCALITY__SIMULATE_MICS)
-  /* Assigns every second unit to a MIC host name.
-   * Useful for simulating a heterogeneous node-level topology
-   * for debugging.
-   */
-  if (myid % 3 == 1) {
-    strncat(uloc->hwinfo.host, "-mic0", 5);
-  }
-#endif
-
-  DART_LOG_DEBUG("dart__base__unit_locality__local_unit_new > loc(%p)",
-                 (void *)uloc);
-  return DART_OK;
-}
-
 /**
  * Default constructor of dart_unit_locality_t.
  */
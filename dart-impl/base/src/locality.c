@@ -15,6 +15,7 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
 #include <dash/dart/base/hwinfo.h>
+#include <dash/dart/base/mutex.h>
 
 #include <dash/dart/base/internal/host_topology.h>
 #include <dash/dart/base/internal/unit_locality.h>
@@ -44,10 +45,32 @@ dart__base__locality__unit_mapping_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
 static dart_domain_locality_t *
 dart__base__locality__global_domain_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
 
+/* Hardware locality of the calling unit, resolved on first use: */
+static dart_hwinfo_t dart__base__locality__hwinfo_;
+
+static int           dart__base__locality__hwinfo_valid_ = 0;
+
+static dart_mutex_t  dart__base__locality__hwinfo_mutex_ =
+                       DART_MUTEX_INITIALIZER;
+
+/* Serializes creation and deletion of team locality data. The global
+ * domain of a team is published last, a non-null entry in
+ * dart__base__locality__global_domain_ refers to complete locality data: */
+static dart_mutex_t  dart__base__locality__mutex_ = DART_MUTEX_INITIALIZER;
+
 /* ====================================================================== *
  * Private Functions                                                      *
  * ====================================================================== */
 
+static dart_ret_t dart__base__locality__exchange_records(
+  dart_team_t                    team,
+  size_t                         num_units,
+  dart_unit_locality_record_t ** records,
+  dart_module_location_t      ** modules);
+
+static dart_ret_t dart__base__locality__delete_locked(
+  dart_team_t                    team);
+
 static int cmpstr_(const void * p1, const void * p2)
 {
   return strcmp(* (char * const *) p1, * (char * const *) p2);
@@ -69,6 +92,16 @@ dart_ret_t dart__base__locality__group_subdomains(
  * Init / Finalize                                                        *
  * ====================================================================== */
 
+/**
+ * Reset the locality data of all teams.
+ *
+ * Neither probes the hardware locality of the calling unit nor exchanges
+ * locality records, both are deferred to the first creation of a team's
+ * locality, see \c dart__base__locality__create.
+ *
+ * \note
+ * This is a local operation.
+ */
 dart_ret_t dart__base__locality__init()
 {
   for (int td = 0; td < DART__BASE__LOCALITY__MAX_TEAM_DOMAINS; ++td) {
@@ -76,7 +109,7 @@ dart_ret_t dart__base__locality__init()
     dart__base__locality__host_topology_[td] = NULL;
     dart__base__locality__unit_mapping_[td]  = NULL;
   }
-  return dart__base__locality__create(DART_TEAM_ALL);
+  return DART_OK;
 }
 
 dart_ret_t dart__base__locality__finalize()
@@ -106,7 +139,7 @@ dart_ret_t dart__base__locality__finalize()
  * 1. All units collect their local hardware locality information
  *    -> dart_hwinfo_t
  *
- * 2. All-to-all exchange of hardware locality data
+ * 2. Exchange the locality records of all units in the team
  *    -> dart_unit_mapping_t { unit, team, hwinfo, domain }
  *
  * 3. Construct host topology from unit mapping data
@@ -115,27 +148,42 @@ dart_ret_t dart__base__locality__finalize()
  * 4. Initialize locality domain hierarchy from unit mapping data and
  *    host topology
  *    -> dart_domain_locality_t
+ *
+ * Returns immediately if the locality data of the team already exists.
+ *
+ * \note
+ * The first call for a team is a collective operation on the team.
+ * Concurrent calls of threads are serialized, the locality data of a team
+ * is only published when it is complete.
  */
 dart_ret_t dart__base__locality__create(
   dart_team_t team)
 {
   DART_LOG_DEBUG("dart__base__locality__create() team(%d)", team);
 
-  /*
-   * TODO: Clarify if returning would be sufficient instead of failing
-   *       assertion.
-   */
-  DART_ASSERT_MSG(
-    (NULL == dart__base__locality__unit_mapping_[team]  &&
-     NULL == dart__base__locality__global_domain_[team] &&
-     NULL == dart__base__locality__host_topology_[team]),
-    "dash__base__locality__create(): "
-    "locality data of team is already initialized");
+  if (team < 0 || team >= DART__BASE__LOCALITY__MAX_TEAM_DOMAINS) {
+    DART_LOG_ERROR("dart__base__locality__create ! "
+                   "team id %d exceeds number of team domains (%d)",
+                   team, DART__BASE__LOCALITY__MAX_TEAM_DOMAINS);
+    return DART_ERR_INVAL;
+  }
+  if (NULL != __atomic_load_n(&dart__base__locality__global_domain_[team],
+                              __ATOMIC_ACQUIRE)) {
+    DART_LOG_DEBUG("dart__base__locality__create > team(%d) "
+                   "already initialized", team);
+    return DART_OK;
+  }
+
+  dart__base__mutex_lock(&dart__base__locality__mutex_);
+  if (NULL != dart__base__locality__global_domain_[team]) {
+    dart__base__mutex_unlock(&dart__base__locality__mutex_);
+    DART_LOG_DEBUG("dart__base__locality__create > team(%d) "
+                   "initialized concurrently", team);
+    return DART_OK;
+  }
 
   dart_domain_locality_t * team_global_domain =
     malloc(sizeof(dart_domain_locality_t));
-  dart__base__locality__global_domain_[team] =
-    team_global_domain;
 
   /* Initialize the global domain as the root entry in the locality
    * hierarchy:
@@ -164,21 +212,28 @@ dart_ret_t dart__base__locality__create(
       DART_OK);
   }
 
-  /* Exchange unit locality information between all units:
+  /* Exchange locality records of all units in the team:
    */
+  dart_unit_locality_record_t * records;
+  dart_module_location_t      * modules;
+  DART_ASSERT_RETURNS(
+    dart__base__locality__exchange_records(
+      team, num_units, &records, &modules),
+    DART_OK);
+
   dart_unit_mapping_t * unit_mapping;
   DART_ASSERT_RETURNS(
-    dart__base__unit_locality__create(team, &unit_mapping),
+    dart__base__unit_locality__create(team, records, &unit_mapping),
     DART_OK);
-  dart__base__locality__unit_mapping_[team] = unit_mapping;
 
   /* Resolve host topology from the unit's host names:
    */
   dart_host_topology_t * topo;
   DART_ASSERT_RETURNS(
-    dart__base__host_topology__create(unit_mapping, &topo),
+    dart__base__host_topology__create(unit_mapping, records, &topo),
     DART_OK);
-  dart__base__locality__host_topology_[team] = topo;
+  free(records);
+  free(modules);
   size_t num_nodes = topo->num_nodes;
   DART_LOG_TRACE("dart__base__locality__create: nodes: %ld", num_nodes);
 
@@ -207,11 +262,16 @@ dart_ret_t dart__base__locality__create(
    */
   DART_ASSERT_RETURNS(
     dart__base__locality__domain__create_subdomains(
-      dart__base__locality__global_domain_[team],
-      dart__base__locality__host_topology_[team],
-      dart__base__locality__unit_mapping_[team]),
+      team_global_domain, topo, unit_mapping),
     DART_OK);
 
+  /* Publish the complete locality data of the team: */
+  dart__base__locality__unit_mapping_[team]  = unit_mapping;
+  dart__base__locality__host_topology_[team] = topo;
+  __atomic_store_n(&dart__base__locality__global_domain_[team],
+                   team_global_domain, __ATOMIC_RELEASE);
+  dart__base__mutex_unlock(&dart__base__locality__mutex_);
+
   DART_LOG_DEBUG("dart__base__locality__create >");
   return DART_OK;
 }
@@ -223,6 +283,26 @@ dart_ret_t dart__base__locality__delete(
 
   DART_LOG_DEBUG("dart__base__locality__delete() team(%d)", team);
 
+  if (team < 0 || team >= DART__BASE__LOCALITY__MAX_TEAM_DOMAINS) {
+    /* Locality data of this team cannot have been created: */
+    return DART_OK;
+  }
+
+  dart__base__mutex_lock(&dart__base__locality__mutex_);
+  ret = dart__base__locality__delete_locked(team);
+  dart__base__mutex_unlock(&dart__base__locality__mutex_);
+  return ret;
+}
+
+/**
+ * Delete the locality data of the team, the caller holds
+ * \c dart__base__locality__mutex_.
+ */
+static dart_ret_t dart__base__locality__delete_locked(
+  dart_team_t team)
+{
+  dart_ret_t ret = DART_OK;
+
   if (NULL != dart__base__locality__global_domain_[team]) {
     ret = dart__base__locality__domain__destruct(
             dart__base__locality__global_domain_[team]);
@@ -280,6 +360,11 @@ dart_ret_t dart__base__locality__team_domain(
   dart_ret_t ret = DART_ERR_NOTFOUND;
 
   *domain_out = NULL;
+
+  ret = dart__base__locality__create(team);
+  if (ret != DART_OK) {
+    return ret;
+  }
   dart_domain_locality_t * domain =
     dart__base__locality__global_domain_[team];
 
@@ -830,8 +915,13 @@ dart_ret_t dart__base__locality__unit(
                  team, unit.id);
   *locality = NULL;
 
+  dart_ret_t ret = dart__base__locality__create(team);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   dart_unit_locality_t * uloc;
-  dart_ret_t ret = dart__base__unit_locality__at(
+  ret = dart__base__unit_locality__at(
                      dart__base__locality__unit_mapping_[team], unit,
                      &uloc);
   if (ret != DART_OK) {
@@ -847,10 +937,95 @@ dart_ret_t dart__base__locality__unit(
   return DART_OK;
 }
 
+dart_ret_t dart__base__locality__local_hwinfo(
+  const dart_hwinfo_t             ** hwinfo)
+{
+  if (!__atomic_load_n(&dart__base__locality__hwinfo_valid_,
+                       __ATOMIC_ACQUIRE)) {
+    dart__base__mutex_lock(&dart__base__locality__hwinfo_mutex_);
+    if (!dart__base__locality__hwinfo_valid_) {
+      dart_ret_t ret = dart_hwinfo(&dart__base__locality__hwinfo_);
+      if (ret != DART_OK) {
+        dart__base__mutex_unlock(&dart__base__locality__hwinfo_mutex_);
+        DART_LOG_ERROR("dart__base__locality__local_hwinfo ! "
+                       "dart_hwinfo failed (%d)", ret);
+        *hwinfo = NULL;
+        return ret;
+      }
+      __atomic_store_n(&dart__base__locality__hwinfo_valid_, 1,
+                       __ATOMIC_RELEASE);
+    }
+    dart__base__mutex_unlock(&dart__base__locality__hwinfo_mutex_);
+  }
+  *hwinfo = &dart__base__locality__hwinfo_;
+  return DART_OK;
+}
+
 /* ====================================================================== *
  * Private Function Definitions                                           *
  * ====================================================================== */
 
+/**
+ * Exchange the locality records of all units in the specified team,
+ * ordered by unit id relative to the team.
+ *
+ * Records are exchanged in a single allgather. Module locations are only
+ * exchanged in a second allgather if any unit in the team reported
+ * modules, the records' \c modules then refer to \c modules.
+ * The returned arrays have to be released by the caller.
+ *
+ * \note
+ * This is a collective operation on the team.
+ */
+static dart_ret_t dart__base__locality__exchange_records(
+  dart_team_t                    team,
+  size_t                         num_units,
+  dart_unit_locality_record_t ** records,
+  dart_module_location_t      ** modules)
+{
+  DART_LOG_DEBUG("dart__base__locality__exchange_records() team(%d)", team);
+  dart_unit_locality_record_t record;
+  DART_ASSERT_RETURNS(
+    dart__base__unit_locality__record_init(&record),
+    DART_OK);
+
+  *records = malloc(num_units * sizeof(dart_unit_locality_record_t));
+  *modules = NULL;
+  DART_ASSERT_RETURNS(
+    dart_allgather(&record, *records, sizeof(dart_unit_locality_record_t),
+                   DART_TYPE_BYTE, team),
+    DART_OK);
+
+  size_t * nrecv       = malloc(num_units * sizeof(size_t));
+  size_t * displs      = malloc(num_units * sizeof(size_t));
+  size_t   num_modules = 0;
+  for (size_t u = 0; u < num_units; ++u) {
+    nrecv[u]  = (*records)[u].num_modules * sizeof(dart_module_location_t);
+    displs[u] = num_modules * sizeof(dart_module_location_t);
+    num_modules += (*records)[u].num_modules;
+    (*records)[u].modules = NULL;
+  }
+  if (num_modules > 0) {
+    *modules = malloc(num_modules * sizeof(dart_module_location_t));
+    DART_ASSERT_RETURNS(
+      dart_allgatherv(record.modules,
+                      record.num_modules * sizeof(dart_module_location_t),
+                      DART_TYPE_BYTE, *modules, nrecv, displs, team),
+      DART_OK);
+    for (size_t u = 0; u < num_units; ++u) {
+      (*records)[u].modules =
+        *modules + displs[u] / sizeof(dart_module_location_t);
+    }
+  }
+  free(nrecv);
+  free(displs);
+  dart__base__unit_locality__record_fini(&record);
+
+  DART_LOG_DEBUG("dart__base__locality__exchange_records > modules:%zu",
+                 num_modules);
+  return DART_OK;
+}
+
 /**
  * Move subset of a domain's immediate child nodes into a group subdomain.
  */
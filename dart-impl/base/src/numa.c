@@ -0,0 +1,111 @@
+/**
+ * \file dash/dart/base/numa.c
+ */
+#include <dash/dart/base/config.h>
+#ifdef DART__PLATFORM__LINUX
+/* _GNU_SOURCE required for sched_getcpu() */
+#  define _GNU_SOURCE
+#  include <sched.h>
+#endif
+
+#include <dash/dart/base/numa.h>
+#include <dash/dart/base/logging.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef DART_ENABLE_NUMA
+#  include <numa.h>
+#  include <numaif.h>
+#endif
+
+dart_ret_t dart__base__numa__place(
+  void                 * addr,
+  size_t                 nbytes,
+  dart_mem_placement_t   placement,
+  int                    numa_id)
+{
+  DART_LOG_TRACE("dart__base__numa__place() addr:%p nbytes:%zu "
+                 "placement:%d numa_id:%d",
+                 addr, nbytes, placement, numa_id);
+
+  if (placement == DART_MEM_PLACE_DEFAULT || addr == NULL || nbytes == 0) {
+    return DART_OK;
+  }
+  if (placement == DART_MEM_PLACE_BIND && numa_id < 0) {
+    DART_LOG_ERROR("dart__base__numa__place ! "
+                   "invalid NUMA domain %d for DART_MEM_PLACE_BIND",
+                   numa_id);
+    return DART_ERR_INVAL;
+  }
+
+#ifdef DART_ENABLE_NUMA
+  if (numa_available() < 0) {
+    DART_LOG_DEBUG("dart__base__numa__place: NUMA policy not supported");
+    return DART_OK;
+  }
+
+  /* Restrict the range to full pages, partial pages at the boundaries
+   * may be shared with other allocations: */
+  uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+  uintptr_t begin     = ((uintptr_t)addr + page_size - 1) & ~(page_size - 1);
+  uintptr_t end       = ((uintptr_t)addr + nbytes) & ~(page_size - 1);
+  if (end <= begin) {
+    return DART_OK;
+  }
+
+  struct bitmask * nodes = NULL;
+  int              mode  = MPOL_BIND;
+  switch (placement) {
+    case DART_MEM_PLACE_LOCAL: {
+#ifdef DART__PLATFORM__LINUX
+      int cpu = sched_getcpu();
+#else
+      int cpu = -1;
+#endif
+      numa_id = (cpu >= 0) ? numa_node_of_cpu(cpu) : -1;
+      if (numa_id < 0) {
+        return DART_OK;
+      }
+      nodes = numa_allocate_nodemask();
+      numa_bitmask_setbit(nodes, numa_id);
+      break;
+    }
+    case DART_MEM_PLACE_BIND:
+      if (numa_id > numa_max_node()) {
+        DART_LOG_ERROR("dart__base__numa__place ! "
+                       "invalid NUMA domain %d, max: %d",
+                       numa_id, numa_max_node());
+        return DART_ERR_INVAL;
+      }
+      nodes = numa_allocate_nodemask();
+      numa_bitmask_setbit(nodes, numa_id);
+      break;
+    case DART_MEM_PLACE_INTERLEAVED:
+      mode  = MPOL_INTERLEAVE;
+      nodes = numa_get_mems_allowed();
+      break;
+    default:
+      DART_LOG_ERROR("dart__base__numa__place ! "
+                     "unknown placement policy %d", placement);
+      return DART_ERR_INVAL;
+  }
+
+  long ret = mbind((void *)begin, end - begin, mode,
+                   nodes->maskp, nodes->size + 1, MPOL_MF_MOVE);
+  numa_bitmask_free(nodes);
+  if (ret != 0) {
+    /* Placement is a performance hint, failing to migrate pages e.g. due
+     * to insufficient memory in the target domain is not an error: */
+    DART_LOG_DEBUG("dart__base__numa__place: mbind failed, placement:%d",
+                   placement);
+  }
+#else
+  DART_LOG_DEBUG("dart__base__numa__place: NUMA support disabled");
+#endif
+
+  return DART_OK;
+}
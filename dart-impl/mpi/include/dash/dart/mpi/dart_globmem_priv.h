@@ -2,9 +2,17 @@
 #define DART__MPI__DART_GLOBMEM_PRIV_H__
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/mpi/dart_team_private.h>
 #include <mpi.h>
 
 /* Global object for one-sided communication on memory region allocated with 'local allocation'. */
 extern MPI_Win dart_win_local_alloc DART_INTERNAL;
 
+/**
+ * Detach all cached registrations of user memory in the team that are
+ * not referenced anymore. Called before the team's window is freed.
+ */
+dart_ret_t dart__mpi__regcache_flush(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
 #endif /* DART__MPI__DART_GLOBMEM_PRIV_H__ */
@@ -10,7 +10,19 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/base/macro.h>
 
+/**
+ * Name of the environment variable that enables the creation of locality
+ * information of \c DART_TEAM_ALL in \c dart_init instead of on first use.
+ */
+#define DART_LOCALITY_EAGER_ENVSTR "DART_LOCALITY_EAGER"
 
+/**
+ * Initialize the locality component. No locality information is probed
+ * or exchanged, locality information of teams is created on first use
+ * unless \c DART_LOCALITY_EAGER is set to a non-zero value. Shared memory
+ * windows do not depend on it, node-local units are determined by
+ * \c MPI_Comm_split_type when a team is created.
+ */
 dart_ret_t dart__mpi__locality_init() DART_INTERNAL;
 
 dart_ret_t dart__mpi__locality_finalize() DART_INTERNAL;
@@ -17,6 +17,24 @@ typedef int16_t dart_segid_t;
 
 #define DART_SEGMENT_HASH_SIZE 256
 
+/**
+ * Default number of unreferenced registrations kept in the registration
+ * cache of a team. Can be overridden by the environment variable
+ * \c DART_REGCACHE_SIZE, a value of 0 disables the cache.
+ */
+#define DART_SEGMENT_REGCACHE_SIZE 16
+
+#define DART_SEGMENT_REGCACHE_ENVSTR "DART_REGCACHE_SIZE"
+
+/**
+ * Default number of bytes per unit kept attached by unreferenced
+ * registrations in the registration cache of a team. Can be overridden by
+ * the environment variable \c DART_REGCACHE_BYTES.
+ */
+#define DART_SEGMENT_REGCACHE_BYTES (256UL * 1024UL * 1024UL)
+
+#define DART_SEGMENT_REGCACHE_BYTES_ENVSTR "DART_REGCACHE_BYTES"
+
 typedef struct
 {
   size_t       size;
@@ -28,6 +46,9 @@ typedef struct
   uint16_t     flags;       /* 16 bit flags */
   dart_segid_t segid;       /* ID of the segment, globally unique in a team */
   bool         is_dynamic;  /* whether this is a shared memory segment */
+  int          refcount;    /* number of registrations, 0 if not cached */
+  uint64_t     last_use;    /* registration cache LRU time stamp */
+  size_t       cached_size; /* maximum size of the registration at any unit */
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
@@ -50,6 +71,24 @@ typedef struct {
    */
   int16_t memid;
   int16_t registermemid;
+
+  /**
+   * Registration cache for segments attached with
+   * dart_team_memregister_persistent, hashed by the local base address of
+   * the registered memory range.
+   * Cached segments without references are released in LRU order once
+   * more than \c regcache_size of them exist or they keep more than
+   * \c regcache_bytes attached. The size of a segment is accounted as its
+   * maximum size at any unit so all units of the team evict the same
+   * segments, \c regcache_count is the number of cached segments.
+   */
+  dart_seghash_elem_t * regcache[DART_SEGMENT_HASH_SIZE];
+  int                   regcache_count;
+  int                   regcache_size;
+  int                   regcache_unused;
+  size_t                regcache_bytes;
+  size_t                regcache_unused_bytes;
+  uint64_t              regcache_clock;
 } dart_segmentdata_t;
 
 typedef enum {
@@ -177,6 +216,79 @@ dart_ret_t dart_segment_free(
   dart_segid_t         segid) DART_INTERNAL;
 
 
+/**
+ * Look up a cached registration of the local memory range
+ * [\c addr, \c addr + \c size) without acquiring a reference on it.
+ *
+ * \return The segment holding the registration or \c NULL if the
+ *         range is not cached.
+ */
+dart_segment_info_t * dart_segment_regcache_lookup(
+  dart_segmentdata_t * segdata,
+  const char         * addr,
+  size_t               size) DART_INTERNAL;
+
+/**
+ * Look up a cached registration overlapping the local memory range
+ * [\c addr, \c addr + \c size), whether it is referenced or not.
+ *
+ * \return A segment overlapping the range or \c NULL.
+ */
+dart_segment_info_t * dart_segment_regcache_overlap(
+  dart_segmentdata_t * segdata,
+  const char         * addr,
+  size_t               size) DART_INTERNAL;
+
+/**
+ * Acquire a reference on the cached segment \c seg found by
+ * \ref dart_segment_regcache_lookup and mark it as most recently used.
+ */
+void dart_segment_regcache_ref(
+  dart_segmentdata_t  * segdata,
+  dart_segment_info_t * seg) DART_INTERNAL;
+
+/**
+ * Add the registered segment \c seg to the registration cache, holding
+ * one reference. No-op if the registration cache is disabled.
+ */
+void dart_segment_regcache_insert(
+  dart_segmentdata_t  * segdata,
+  dart_segment_info_t * seg) DART_INTERNAL;
+
+/**
+ * Release a reference on the cached segment \c seg. The segment stays
+ * cached after its last reference has been released.
+ */
+void dart_segment_regcache_release(
+  dart_segmentdata_t  * segdata,
+  dart_segment_info_t * seg) DART_INTERNAL;
+
+/**
+ * Select the least recently used unreferenced cached segment to be evicted
+ * if the cache exceeds its capacity in number of segments or attached
+ * bytes.
+ *
+ * The caller is responsible for detaching the segment's memory and
+ * releasing the segment using \ref dart_segment_free.
+ *
+ * \return The segment to evict or \c NULL if no eviction is required.
+ */
+dart_segment_info_t * dart_segment_regcache_victim(
+  dart_segmentdata_t * segdata) DART_INTERNAL;
+
+struct dart_team_data;
+
+/**
+ * Publish the base addresses of a segment in the table of segment base
+ * addresses used to resolve native addresses of global pointers in inline
+ * functions, see \c dart_gptr_getaddr_fast.
+ * The entry is revoked in \ref dart_segment_free and
+ * \ref dart_segment_fini.
+ */
+void dart_segment_addr_publish(
+  const struct dart_team_data * team_data,
+  const dart_segment_info_t   * seg) DART_INTERNAL;
+
 /**
  * Clear the segment data hash table.
  */
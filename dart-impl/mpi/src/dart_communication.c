@@ -1820,7 +1820,14 @@ dart_ret_t dart_handle_free(
   dart_handle_t * handleptr)
 {
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
-    free(*handleptr);
+    dart_handle_t handle = *handleptr;
+    // release pending requests, e.g. of dart_isend and dart_irecv:
+    for (uint8_t i = 0; i < handle->num_reqs; ++i) {
+      if (handle->reqs[i] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&handle->reqs[i]);
+      }
+    }
+    free(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   return DART_OK;
@@ -2208,6 +2215,46 @@ dart_ret_t dart_allreduce(
   return DART_OK;
 }
 
+dart_ret_t dart_exscan(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_exscan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+  MPI_Comm comm = team_data->comm;
+  CHECK_MPI_RET(
+    MPI_Exscan(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           comm),
+    "MPI_Exscan");
+  return DART_OK;
+}
+
 dart_ret_t dart_alltoall(
     const void *    sendbuf,
     void *          recvbuf,
@@ -2442,3 +2489,117 @@ dart_ret_t dart_sendrecv(
     "MPI_Sendrecv");
   return DART_OK;
 }
+
+dart_ret_t dart_isend(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handleptr)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  dart_team_t team = DART_TEAM_ALL;
+
+  *handleptr = DART_HANDLE_NULL;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_isend ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_isend ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(unit, team_data);
+
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = unit.id;
+  handle->win          = MPI_WIN_NULL;
+  handle->needs_flush  = false;
+  handle->num_reqs     = 1;
+
+  DART_LOG_DEBUG("dart_isend() unit:%d tag:%d nelem:%zu handle:%p",
+                 unit.id, tag, nelem, (void *)(handle));
+
+  // dart_unit = MPI rank in comm_world
+  if (MPI_Isend(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        unit.id,
+        tag,
+        team_data->comm,
+        &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_isend ! MPI_Isend failed");
+    free(handle);
+    return DART_ERR_OTHER;
+  }
+
+  *handleptr = handle;
+  return DART_OK;
+}
+
+dart_ret_t dart_irecv(
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handleptr)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  dart_team_t team = DART_TEAM_ALL;
+
+  *handleptr = DART_HANDLE_NULL;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_irecv ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_irecv ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(unit, team_data);
+
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = unit.id;
+  handle->win          = MPI_WIN_NULL;
+  handle->needs_flush  = false;
+  handle->num_reqs     = 1;
+
+  DART_LOG_DEBUG("dart_irecv() unit:%d tag:%d nelem:%zu handle:%p",
+                 unit.id, tag, nelem, (void *)(handle));
+
+  // dart_unit = MPI rank in comm_world
+  if (MPI_Irecv(
+        recvbuf,
+        nelem,
+        mpi_dtype,
+        unit.id,
+        tag,
+        team_data->comm,
+        &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_irecv ! MPI_Irecv failed");
+    free(handle);
+    return DART_ERR_OTHER;
+  }
+
+  *handleptr = handle;
+  return DART_OK;
+}
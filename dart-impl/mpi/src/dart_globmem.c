@@ -10,6 +10,7 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/atomic.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/numa.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -121,6 +122,15 @@ dart_ret_t dart_gptr_setflags(dart_gptr_t *gptr, uint16_t flags)
   return DART_OK;
 }
 
+dart_ret_t dart_mem_place(
+  void                 * addr,
+  size_t                 nbytes,
+  dart_mem_placement_t   placement,
+  int                    numa_id)
+{
+  return dart__base__numa__place(addr, nbytes, placement, numa_id);
+}
+
 
 dart_ret_t dart_memalloc(
   size_t            nelem,
@@ -352,6 +362,7 @@ dart_team_memalloc_aligned_dynamic(
   segment->win     = team_data->window;
   segment->selfbaseptr = sub_mem;
   segment->is_dynamic  = true;
+  dart_segment_addr_publish(team_data, segment);
 
 
   /* -- Updating infos on gptr -- */
@@ -429,6 +440,7 @@ dart_team_memalloc_aligned_full(
   segment->shmwin      = MPI_WIN_NULL;
   segment->win         = win;
   segment->is_dynamic  = false;
+  dart_segment_addr_publish(team_data, segment);
 
 
   gptr->segid  = segment->segid;
@@ -542,6 +554,146 @@ dart_ret_t dart_team_memfree(
   return DART_OK;
 }
 
+/**
+ * Detach and release a cached registration selected by
+ * \ref dart_segment_regcache_victim.
+ */
+static void
+dart__mpi__regcache_evict(
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * segment)
+{
+  DART_LOG_DEBUG("dart__mpi__regcache_evict: segid:%d addr:%p nbytes:%zu "
+                 "team:%d", segment->segid, segment->selfbaseptr,
+                 segment->size, team_data->teamid);
+  if (segment->size > 0) {
+    MPI_Win_detach(team_data->window, segment->selfbaseptr);
+  }
+  dart_segment_free(&team_data->segdata, segment->segid);
+}
+
+dart_ret_t
+dart__mpi__regcache_flush(
+  dart_team_data_t    * team_data)
+{
+  int regcache_size = team_data->segdata.regcache_size;
+  team_data->segdata.regcache_size = 0;
+  dart_segment_info_t *victim;
+  while ((victim = dart_segment_regcache_victim(
+                     &team_data->segdata)) != NULL) {
+    dart__mpi__regcache_evict(team_data, victim);
+  }
+  team_data->segdata.regcache_size = regcache_size;
+  return DART_OK;
+}
+
+/**
+ * Resolve a conflict of the local range [addr, addr + nbytes) of a new
+ * registration with cached registrations, \c conflict is set if any
+ * unit of the team found a conflict.
+ * Unused cached registrations are flushed and the ranges checked again,
+ * the registration fails at all units if a range still overlaps a
+ * registration in use.
+ *
+ * Collective on the team if \c conflict is set.
+ */
+static dart_ret_t
+dart__mpi__regcache_resolve(
+  dart_team_data_t    * team_data,
+  void                * addr,
+  size_t                nbytes,
+  int                   conflict)
+{
+  if (!conflict) {
+    return DART_OK;
+  }
+  dart__mpi__regcache_flush(team_data);
+  int overlap = (nbytes > 0 &&
+                 dart_segment_regcache_overlap(
+                   &team_data->segdata, addr, nbytes) != NULL);
+  MPI_Allreduce(&overlap, &conflict, 1, MPI_INT, MPI_LOR, team_data->comm);
+  if (conflict) {
+    DART_LOG_ERROR("dart_team_memregister ! failed: range %p of %zu bytes "
+                   "at some unit overlaps a cached registration in use",
+                   addr, nbytes);
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+/**
+ * Check that the local range [addr, addr + nbytes) of a non-persistent
+ * registration does not overlap a cached registration.
+ *
+ * The cache holds the same segments at all units of the team, so all units
+ * communicate if any cached segment exists.
+ */
+static dart_ret_t
+dart__mpi__regcache_check(
+  dart_team_data_t    * team_data,
+  void                * addr,
+  size_t                nbytes)
+{
+  if (team_data->segdata.regcache_count == 0) {
+    return DART_OK;
+  }
+  int overlap = (nbytes > 0 &&
+                 dart_segment_regcache_overlap(
+                   &team_data->segdata, addr, nbytes) != NULL);
+  int conflict;
+  MPI_Allreduce(&overlap, &conflict, 1, MPI_INT, MPI_LOR, team_data->comm);
+  return dart__mpi__regcache_resolve(team_data, addr, nbytes, conflict);
+}
+
+/**
+ * Serve a persistent registration of [addr, addr + nbytes) from the
+ * registration cache if all units of the team hit the same cached
+ * segment, otherwise resolve conflicts of the range with the cache.
+ *
+ * The cache holds the same segments at all units of the team, so all units
+ * communicate if any cached segment exists.
+ *
+ * \return \c DART_OK with \c segment set to the cached segment or \c NULL
+ *         on a cache miss, \c DART_ERR_INVAL if the range conflicts with a
+ *         registration in use.
+ */
+static dart_ret_t
+dart__mpi__regcache_acquire(
+  dart_team_data_t     * team_data,
+  void                 * addr,
+  size_t                 nbytes,
+  dart_segment_info_t ** segment)
+{
+  *segment = NULL;
+  if (team_data->segdata.regcache_count == 0) {
+    return DART_OK;
+  }
+  dart_segment_info_t *hit = dart_segment_regcache_lookup(
+                               &team_data->segdata, addr, nbytes);
+  /*
+   * Reduce the maximum and minimum of the hit flags and of the segment
+   * IDs hit, and whether any range overlaps a cached segment without
+   * hitting it.
+   */
+  int local[5], all[5];
+  local[0] = (hit != NULL);
+  local[1] = -local[0];
+  local[2] = (hit != NULL) ? hit->segid : 0;
+  local[3] = -local[2];
+  local[4] = (hit == NULL && nbytes > 0 &&
+              dart_segment_regcache_overlap(
+                &team_data->segdata, addr, nbytes) != NULL);
+  MPI_Allreduce(local, all, 5, MPI_INT, MPI_MAX, team_data->comm);
+  if (-all[1] == 1 && all[2] == -all[3]) {
+    dart_segment_regcache_ref(&team_data->segdata, hit);
+    *segment = hit;
+    return DART_OK;
+  }
+  /* a hit at some units only conflicts with the new registration */
+  return dart__mpi__regcache_resolve(
+           team_data, addr, nbytes, all[4] || all[0]);
+}
+
 dart_ret_t
 dart_team_memregister_aligned(
    dart_team_t       teamid,
@@ -567,6 +719,10 @@ dart_team_memregister_aligned(
     return DART_ERR_INVAL;
   }
 
+  if (dart__mpi__regcache_check(team_data, addr, nbytes) != DART_OK) {
+    return DART_ERR_INVAL;
+  }
+
   dart_segment_info_t *segment = dart_segment_alloc(
                                 &team_data->segdata, DART_SEGMENT_REGISTER);
   if (segment == NULL) {
@@ -583,7 +739,10 @@ dart_team_memregister_aligned(
 
   MPI_Comm comm = team_data->comm;
   MPI_Win win = team_data->window;
-  MPI_Win_attach(win, addr, nbytes);
+  /* Empty ranges are not attached, see #239 */
+  if (nbytes > 0) {
+    MPI_Win_attach(win, addr, nbytes);
+  }
   MPI_Get_address(addr, &disp);
   MPI_Allgather(&disp, 1, MPI_AINT, disp_set, 1, MPI_AINT, comm);
 
@@ -592,6 +751,7 @@ dart_team_memregister_aligned(
   segment->win     = team_data->window;
   segment->selfbaseptr = (char *)addr;
   segment->flags   = 0;
+  dart_segment_addr_publish(team_data, segment);
 
   gptr->unitid = gptr_unitid;
   gptr->segid  = segment->segid;
@@ -639,6 +799,10 @@ dart_team_memregister(
     return DART_ERR_INVAL;
   }
 
+  if (dart__mpi__regcache_check(team_data, addr, nbytes) != DART_OK) {
+    return DART_ERR_INVAL;
+  }
+
   dart_segment_info_t *segment = dart_segment_alloc(
                                 &team_data->segdata, DART_SEGMENT_REGISTER);
   if (segment == NULL) {
@@ -655,7 +819,10 @@ dart_team_memregister(
   MPI_Aint * disp_set = segment->disp;
   MPI_Comm   comm     = team_data->comm;
   MPI_Win    win      = team_data->window;
-  MPI_Win_attach(win, addr, nbytes);
+  /* Empty ranges are not attached, see #239 */
+  if (nbytes > 0) {
+    MPI_Win_attach(win, addr, nbytes);
+  }
   MPI_Get_address(addr, &disp);
   MPI_Allgather(&disp, 1, MPI_AINT, disp_set, 1, MPI_AINT, comm);
 
@@ -664,6 +831,7 @@ dart_team_memregister(
   segment->win    = team_data->window;
   segment->selfbaseptr = (char *)addr;
   segment->flags = 0;
+  dart_segment_addr_publish(team_data, segment);
 
 
   gptr->unitid = gptr_unitid;
@@ -683,6 +851,104 @@ dart_team_memregister(
   return DART_OK;
 }
 
+dart_ret_t
+dart_team_memregister_persistent(
+   dart_team_t       teamid,
+   size_t            nelem,
+   dart_datatype_t   dtype,
+   void            * addr,
+   dart_gptr_t     * gptr)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  size_t size;
+  int    dtype_size = dart__mpi__datatype_sizeof(dtype);
+  size_t nbytes     = nelem * dtype_size;
+  dart_unit_t gptr_unitid = 0;
+  dart_team_size(teamid, &size);
+
+  *gptr = DART_GPTR_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_memregister_persistent ! failed: "
+                   "Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *segment;
+  if (dart__mpi__regcache_acquire(
+        team_data, addr, nbytes, &segment) != DART_OK) {
+    return DART_ERR_INVAL;
+  }
+  if (segment != NULL) {
+    gptr->unitid = gptr_unitid;
+    gptr->segid  = segment->segid;
+    gptr->teamid = teamid;
+    gptr->flags  = 0;
+    gptr->addr_or_offs.offset = 0;
+    return DART_OK;
+  }
+
+  segment = dart_segment_alloc(&team_data->segdata, DART_SEGMENT_REGISTER);
+  if (segment == NULL) {
+    DART_LOG_ERROR(
+        "dart_team_memregister_persistent: bytes:%lu "
+        "Allocation of segment data failed", nbytes);
+    return DART_ERR_OTHER;
+  }
+
+  if (segment->disp == NULL) {
+    segment->disp = malloc(size * sizeof(MPI_Aint));
+  }
+  MPI_Aint * disp_set = segment->disp;
+  MPI_Comm   comm     = team_data->comm;
+  MPI_Win    win      = team_data->window;
+  /* Empty ranges are not attached, see #239 */
+  if (nbytes > 0) {
+    MPI_Win_attach(win, addr, nbytes);
+  }
+  /*
+   * Gather the sizes of the range at all units together with their
+   * displacements, the maximum size is accounted in the registration cache
+   * so all units evict the same segments.
+   */
+  MPI_Aint   local[2];
+  MPI_Aint * all = malloc(2 * size * sizeof(MPI_Aint));
+  MPI_Get_address(addr, &local[0]);
+  local[1] = (MPI_Aint)nbytes;
+  MPI_Allgather(local, 2, MPI_AINT, all, 2, MPI_AINT, comm);
+  size_t cached_size = 0;
+  for (size_t u = 0; u < size; ++u) {
+    disp_set[u] = all[2 * u];
+    if ((size_t)all[2 * u + 1] > cached_size) {
+      cached_size = (size_t)all[2 * u + 1];
+    }
+  }
+  free(all);
+
+  segment->size        = nbytes;
+  segment->cached_size = cached_size;
+  segment->shmwin      = MPI_WIN_NULL;
+  segment->win         = team_data->window;
+  segment->selfbaseptr = (char *)addr;
+  segment->flags       = 0;
+  dart_segment_addr_publish(team_data, segment);
+  // cached on all units, even if empty, to keep the cache state in sync
+  dart_segment_regcache_insert(&team_data->segdata, segment);
+
+  gptr->unitid = gptr_unitid;
+  gptr->segid  = segment->segid;
+  gptr->teamid = teamid;
+  gptr->flags  = 0;
+  gptr->addr_or_offs.offset = 0;
+
+  DART_LOG_DEBUG(
+    "dart_team_memregister_persistent: collective alloc, "
+    "nbytes:%zu segid:%d across team %d",
+    nbytes, segment->segid, teamid);
+  return DART_OK;
+}
+
 dart_ret_t
 dart_team_memderegister(
    dart_gptr_t gptr)
@@ -705,13 +971,35 @@ dart_team_memderegister(
 
   win = team_data->window;
 
+  dart_segment_info_t *segment = dart_segment_get_info(
+                                   &team_data->segdata, segid);
+  if (segment == NULL) {
+    DART_LOG_ERROR("dart_team_memderegister ! Unknown segment %i", segid);
+    return DART_ERR_INVAL;
+  }
+
+  if (segment->refcount > 0) {
+    /* Keep the registration cached, evict exceeding unused entries */
+    dart_segment_regcache_release(&team_data->segdata, segment);
+    dart_segment_info_t *victim;
+    while ((victim = dart_segment_regcache_victim(
+                       &team_data->segdata)) != NULL) {
+      dart__mpi__regcache_evict(team_data, victim);
+    }
+    DART_LOG_DEBUG("dart_team_memderegister: released cached segment %i "
+                   "across team %d", segid, teamid);
+    return DART_OK;
+  }
+
   if (dart_segment_get_selfbaseptr(
         &team_data->segdata, segid, &sub_mem) != DART_OK) {
     DART_LOG_ERROR("dart_team_memderegister ! Unknown segment %i", segid);
     return DART_ERR_INVAL;
   }
 
-  MPI_Win_detach(win, sub_mem);
+  if (segment->size > 0) {
+    MPI_Win_detach(win, sub_mem);
+  }
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
   }
@@ -726,3 +1014,18 @@ dart_team_memderegister(
     unitid.id, gptr.addr_or_offs.offset, gptr.unitid, teamid);
   return DART_OK;
 }
+
+dart_ret_t
+dart_team_memregister_flush(
+   dart_team_t teamid)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_memregister_flush ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+  /* no unit may access the registrations any more once detached */
+  MPI_Barrier(team_data->comm);
+  return dart__mpi__regcache_flush(team_data);
+}
@@ -133,6 +133,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   // addressing in this window is relative, no need to store displacements
   segment->disp        = calloc(team_data->size, sizeof(MPI_Aint));
   segment->is_dynamic       = false;
+  dart_segment_addr_publish(team_data, segment);
 
   return DART_OK;
 }
@@ -325,6 +326,7 @@ dart_ret_t dart_exit()
     MPI_Free_mem(dart_mempool_localalloc);
   }
 #endif
+  dart__mpi__regcache_flush(team_data);
   MPI_Win_free(&team_data->window);
 
   dart_segment_fini(&team_data->segdata);
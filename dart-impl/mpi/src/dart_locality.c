@@ -306,3 +306,8 @@ dart_ret_t dart_unit_locality(
   return DART_OK;
 }
 
+dart_ret_t dart_unit_hwinfo(
+  const dart_hwinfo_t          ** hwinfo)
+{
+  return dart__base__locality__local_hwinfo(hwinfo);
+}
@@ -13,6 +13,8 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/locality.h>
 
+#include <stdlib.h>
+
 
 dart_ret_t dart__mpi__locality_init()
 {
@@ -25,6 +27,17 @@ dart_ret_t dart__mpi__locality_init()
                    "dart__base__locality__init failed: %d", ret);
     return ret;
   }
+
+  const char * envstr = getenv(DART_LOCALITY_EAGER_ENVSTR);
+  if (envstr != NULL && atoi(envstr) != 0) {
+    DART_LOG_DEBUG("dart__mpi__locality_init: eager locality creation");
+    ret = dart__base__locality__create(DART_TEAM_ALL);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart__mpi__locality_init ! "
+                     "dart__base__locality__create failed: %d", ret);
+      return ret;
+    }
+  }
   DART_LOG_DEBUG("dart__mpi__locality_init >");
   return DART_OK;
 }
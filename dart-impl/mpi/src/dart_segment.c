@@ -1,6 +1,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
@@ -12,10 +14,14 @@
 
 struct dart_seghash_elem {
   dart_seghash_elem_t *next;
+  dart_seghash_elem_t *regcache_next;
   dart_segment_info_t  data;
 };
 
 
+/* Base addresses of segments, read in dart__segment_addr_lookup: */
+dart_segment_addr_t dart__segment_addr_tab[DART_SEGMENT_ADDR_TAB_SIZE];
+
 static inline int hash_segid(dart_segid_t segid)
 {
   /* Simply use the lower bits of the segment ID.
@@ -27,6 +33,19 @@ static inline int hash_segid(dart_segid_t segid)
   return (abs(segid) % DART_SEGMENT_HASH_SIZE);
 }
 
+static inline int hash_addr(const char *addr)
+{
+  /* Registered buffers are at least word-aligned, ignore the lower bits */
+  return (int)(((uintptr_t)addr >> 6) % DART_SEGMENT_HASH_SIZE);
+}
+
+static inline dart_seghash_elem_t *
+seghash_elem(dart_segment_info_t *seg)
+{
+  return (dart_seghash_elem_t *)
+           ((char *)seg - offsetof(dart_seghash_elem_t, data));
+}
+
 static inline void
 register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
 {
@@ -80,6 +99,25 @@ dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
   segdata->memid = 1;
   segdata->registermemid = -1;
 
+  memset(segdata->regcache, 0,
+    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  segdata->regcache_count  = 0;
+  segdata->regcache_size   = DART_SEGMENT_REGCACHE_SIZE;
+  segdata->regcache_unused = 0;
+  segdata->regcache_bytes  = DART_SEGMENT_REGCACHE_BYTES;
+  segdata->regcache_unused_bytes = 0;
+  segdata->regcache_clock  = 0;
+  const char *envstr = getenv(DART_SEGMENT_REGCACHE_ENVSTR);
+  if (envstr != NULL) {
+    int size = atoi(envstr);
+    segdata->regcache_size = (size > 0) ? size : 0;
+  }
+  envstr = getenv(DART_SEGMENT_REGCACHE_BYTES_ENVSTR);
+  if (envstr != NULL) {
+    long long bytes = atoll(envstr);
+    segdata->regcache_bytes = (bytes > 0) ? (size_t)bytes : 0;
+  }
+
   return DART_OK;
 }
 
@@ -272,6 +310,196 @@ dart_ret_t dart_segment_set_flags(
 }
 
 
+static void regcache_remove(
+  dart_segmentdata_t  * segdata,
+  dart_seghash_elem_t * elem)
+{
+  dart_seghash_elem_t **pos =
+    &segdata->regcache[hash_addr(elem->data.selfbaseptr)];
+  while (*pos != NULL) {
+    if (*pos == elem) {
+      *pos = elem->regcache_next;
+      segdata->regcache_count--;
+      break;
+    }
+    pos = &(*pos)->regcache_next;
+  }
+  if (elem->data.refcount == 0) {
+    segdata->regcache_unused--;
+    segdata->regcache_unused_bytes -= elem->data.cached_size;
+  }
+  elem->regcache_next  = NULL;
+  elem->data.refcount    = 0;
+  elem->data.last_use    = 0;
+  elem->data.cached_size = 0;
+}
+
+dart_segment_info_t * dart_segment_regcache_lookup(
+  dart_segmentdata_t * segdata,
+  const char         * addr,
+  size_t               size)
+{
+  if (segdata->regcache_size == 0) {
+    return NULL;
+  }
+  dart_seghash_elem_t *elem = segdata->regcache[hash_addr(addr)];
+  while (elem != NULL) {
+    if (elem->data.selfbaseptr == addr && elem->data.size == size) {
+      DART_LOG_DEBUG("dart_segment_regcache_lookup: hit addr:%p size:%zu "
+                     "segid:%d refcount:%d team_id:%d",
+                     addr, size, elem->data.segid, elem->data.refcount,
+                     segdata->team_id);
+      return &(elem->data);
+    }
+    elem = elem->regcache_next;
+  }
+  return NULL;
+}
+
+dart_segment_info_t * dart_segment_regcache_overlap(
+  dart_segmentdata_t * segdata,
+  const char         * addr,
+  size_t               size)
+{
+  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
+    for (dart_seghash_elem_t *elem = segdata->regcache[i];
+         elem != NULL;
+         elem = elem->regcache_next) {
+      dart_segment_info_t *seg = &(elem->data);
+      if (seg->selfbaseptr < addr + size &&
+          addr < seg->selfbaseptr + seg->size) {
+        return seg;
+      }
+    }
+  }
+  return NULL;
+}
+
+void dart_segment_regcache_ref(
+  dart_segmentdata_t  * segdata,
+  dart_segment_info_t * seg)
+{
+  if (seg->refcount++ == 0) {
+    segdata->regcache_unused--;
+    segdata->regcache_unused_bytes -= seg->cached_size;
+  }
+  seg->last_use = ++segdata->regcache_clock;
+}
+
+void dart_segment_regcache_insert(
+  dart_segmentdata_t  * segdata,
+  dart_segment_info_t * seg)
+{
+  if (segdata->regcache_size == 0) {
+    return;
+  }
+  dart_seghash_elem_t *elem = seghash_elem(seg);
+  int slot = hash_addr(seg->selfbaseptr);
+  elem->regcache_next     = segdata->regcache[slot];
+  segdata->regcache[slot] = elem;
+  segdata->regcache_count++;
+  seg->refcount = 1;
+  seg->last_use = ++segdata->regcache_clock;
+}
+
+void dart_segment_regcache_release(
+  dart_segmentdata_t  * segdata,
+  dart_segment_info_t * seg)
+{
+  DART_ASSERT(seg->refcount > 0);
+  if (--seg->refcount == 0) {
+    segdata->regcache_unused++;
+    segdata->regcache_unused_bytes += seg->cached_size;
+  }
+}
+
+dart_segment_info_t * dart_segment_regcache_victim(
+  dart_segmentdata_t * segdata)
+{
+  if (segdata->regcache_unused       <= segdata->regcache_size &&
+      segdata->regcache_unused_bytes <= segdata->regcache_bytes) {
+    return NULL;
+  }
+  dart_segment_info_t *victim = NULL;
+  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
+    for (dart_seghash_elem_t *elem = segdata->regcache[i];
+         elem != NULL;
+         elem = elem->regcache_next) {
+      dart_segment_info_t *seg = &(elem->data);
+      if (seg->refcount > 0) {
+        continue;
+      }
+      if (victim == NULL || seg->last_use < victim->last_use) {
+        victim = seg;
+      }
+    }
+  }
+  return victim;
+}
+
+/*
+ * Entries of the segment address table are updated like a sequence lock:
+ * the version is odd while an entry is modified so concurrent readers
+ * discard what they have read.
+ */
+static inline dart_segment_addr_t * segment_addr_lock(int slot)
+{
+  dart_segment_addr_t * entry = &dart__segment_addr_tab[slot];
+  uint32_t version;
+  do {
+    version = __atomic_load_n(&entry->version, __ATOMIC_RELAXED) & ~1u;
+  } while (!__atomic_compare_exchange_n(
+              &entry->version, &version, version + 1, false,
+              __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  return entry;
+}
+
+static inline void segment_addr_unlock(dart_segment_addr_t * entry)
+{
+  __atomic_store_n(&entry->version, entry->version + 1, __ATOMIC_RELEASE);
+}
+
+static inline void segment_addr_clear(dart_segment_addr_t * entry)
+{
+  entry->teamid      = DART_TEAM_NULL;
+  entry->selfbaseptr = NULL;
+  entry->baseptr     = NULL;
+}
+
+static void segment_addr_revoke(dart_team_t teamid, dart_segid_t segid)
+{
+  dart_segment_addr_t * entry =
+    segment_addr_lock(dart__segment_addr_slot(teamid, segid));
+  if (entry->teamid == teamid && entry->segid == segid) {
+    segment_addr_clear(entry);
+  }
+  segment_addr_unlock(entry);
+}
+
+void dart_segment_addr_publish(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seg)
+{
+  dart_segment_addr_t * entry =
+    segment_addr_lock(dart__segment_addr_slot(team_data->teamid,
+                                              seg->segid));
+  entry->teamid        = team_data->teamid;
+  entry->segid         = seg->segid;
+  entry->myid          = team_data->unitid;
+  entry->selfbaseptr   = seg->selfbaseptr;
+  entry->baseptr       = NULL;
+  entry->sharedmem_tab = NULL;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  /* Registered memory is not allocated in shared memory windows: */
+  if (seg->segid >= 0 && seg->baseptr != NULL) {
+    entry->baseptr       = seg->baseptr;
+    entry->sharedmem_tab = team_data->sharedmem_tab;
+  }
+#endif
+  segment_addr_unlock(entry);
+}
+
 static inline void free_segment_info(dart_segment_info_t *seg_info){
   if (seg_info->disp != NULL) {
     free(seg_info->disp);
@@ -301,6 +529,8 @@ dart_ret_t dart_segment_free(
   dart_seghash_elem_t *pred = NULL;
   dart_seghash_elem_t *elem = segdata->hashtab[slot];
 
+  segment_addr_revoke(segdata->team_id, segid);
+
   // find the correct entry in this bucket
   pred = NULL;
   while (elem != NULL) {
@@ -311,6 +541,9 @@ dart_ret_t dart_segment_free(
       } else {
         segdata->hashtab[slot] = elem->next;
       }
+      if (elem->data.refcount > 0 || elem->data.last_use > 0) {
+        regcache_remove(segdata, elem);
+      }
       // no need for locking since operations on the same segmentdata
       // are not thread-safe
       if (segid > 0) {
@@ -365,6 +598,17 @@ dart_ret_t dart_segment_fini(
     free_segment_info(seg);
   }
 
+  // revoke published base addresses of the team's segments
+  for (int i = 0; i < DART_SEGMENT_ADDR_TAB_SIZE; i++) {
+    if (dart__segment_addr_tab[i].teamid == segdata->team_id) {
+      dart_segment_addr_t * entry = segment_addr_lock(i);
+      if (entry->teamid == segdata->team_id) {
+        segment_addr_clear(entry);
+      }
+      segment_addr_unlock(entry);
+    }
+  }
+
   // clear the remaining hash table
   for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
     clear_segdata_list(segdata->hashtab[i]);
@@ -376,5 +620,10 @@ dart_ret_t dart_segment_fini(
   clear_segdata_list(segdata->reg_freelist);
   segdata->reg_freelist = NULL;
 
+  memset(segdata->regcache, 0,
+    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  segdata->regcache_count  = 0;
+  segdata->regcache_unused = 0;
+
   return DART_OK;
 }
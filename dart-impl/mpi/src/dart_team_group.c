@@ -19,6 +19,7 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_group_priv.h>
 #include <dash/dart/mpi/dart_synchronization_priv.h>
+#include <dash/dart/mpi/dart_globmem_priv.h>
 
 #include <limits.h>
 
@@ -672,6 +673,7 @@ dart_ret_t dart_team_destroy(
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
 #endif
+  dart__mpi__regcache_flush(team_data);
   win = team_data->window;
   MPI_Win_unlock_all(win);
   MPI_Win_free(&win);
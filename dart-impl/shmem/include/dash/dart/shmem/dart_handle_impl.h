@@ -0,0 +1,48 @@
+#ifndef DART_HANDLE_IMPL_H_INCLUDED
+#define DART_HANDLE_IMPL_H_INCLUDED
+
+#include <stddef.h>
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/dart/shmem/extern_c.h>
+EXTERN_C_BEGIN
+
+/*
+ * Handle of a pending non-blocking operation.
+ *
+ * Copies of non-blocking get and put operations are executed by the
+ * helper thread if it is enabled and are deferred to the first wait or
+ * test on the handle otherwise. Sends and receives progress in every
+ * wait or test, see dart_shmem_p2p_progress.
+ */
+struct dart_handle_struct
+{
+  /* WORK_NB_SEND, WORK_NB_RECV, WORK_NB_GET or WORK_NB_PUT */
+  int            selector;
+  void         * dest;
+  const void   * src;
+  size_t         nbytes;
+  dart_team_t    team;
+  dart_unit_t    unit;
+  /* set once the operation completed, written by the helper thread */
+  int            complete;
+  /* message tag, bytes transferred and result of sends and receives */
+  int            tag;
+  size_t         offs;
+  dart_ret_t     status;
+  /* set if the handle was released before the operation completed */
+  int            detached;
+  /* next pending send to or receive from the same unit */
+  struct dart_handle_struct * next;
+};
+
+/*
+ * Execute the copy of a non-blocking get or put operation and mark its
+ * handle as completed.
+ */
+void dart_shmem_handle_copy(dart_handle_t handle);
+
+EXTERN_C_END
+
+#endif /* DART_HANDLE_IMPL_H_INCLUDED */
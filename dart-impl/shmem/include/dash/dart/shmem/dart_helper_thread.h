@@ -23,7 +23,7 @@ typedef struct work_item
   dart_unit_t    unit;
   dart_team_t    team;
   dart_gptr_t    gptr;
-  dart_handle_t  *handle;
+  dart_handle_t  handle;
 } 
 work_item_t;
 
@@ -1,6 +1,9 @@
 #ifndef DART_SHMEM_H_INCLUDED
 #define DART_SHMEM_H_INCLUDED
 
+#include <stddef.h>
+
+#include <dash/dart/if/dart_types.h>
 #include <dash/dart/shmem/extern_c.h>
 EXTERN_C_BEGIN
 
@@ -19,6 +22,25 @@ extern int _glob_state;
 #define DART_INIT_CHECK()						\
   if( _glob_state!=DART_STATE_INITIALIZED ) return DART_ERR_NOTINIT;
 
+/* size in bytes of a basic DART data type, 0 for unknown types */
+static inline size_t dart_shmem_datatype_sizeof(dart_datatype_t dtype)
+{
+  switch (dtype) {
+    case DART_TYPE_BYTE        : return sizeof(char);
+    case DART_TYPE_SHORT       : return sizeof(short);
+    case DART_TYPE_INT         : return sizeof(int);
+    case DART_TYPE_UINT        : return sizeof(unsigned int);
+    case DART_TYPE_LONG        : return sizeof(long);
+    case DART_TYPE_ULONG       : return sizeof(unsigned long);
+    case DART_TYPE_LONGLONG    : return sizeof(long long);
+    case DART_TYPE_ULONGLONG   : return sizeof(unsigned long long);
+    case DART_TYPE_FLOAT       : return sizeof(float);
+    case DART_TYPE_DOUBLE      : return sizeof(double);
+    case DART_TYPE_LONG_DOUBLE : return sizeof(long double);
+    default                    : return 0;
+  }
+}
+
 
 EXTERN_C_END
 
@@ -14,12 +14,17 @@
 #include <dash/dart/shmem/extern_c.h>
 EXTERN_C_BEGIN
 
+/*
+ * Sense-reversing barrier in shared memory. Arriving units increment
+ * num_waiting, the last unit to arrive resets the counter and advances
+ * the generation. Waiting units spin on the generation for a short time
+ * and then sleep in a futex wait on it.
+ */
 struct sysv_barrier
 {
-  pthread_mutex_t  mutex;
-  pthread_cond_t   cond;
   int num_waiting;
   int num_procs;
+  int generation;
 };
 
 
@@ -36,11 +41,20 @@ struct dart_lock_struct
 };
 
 
+/*
+ * Size of the buffer in shared memory used by collective operations
+ * of a team, see shmem_coll_if.h
+ */
+#define SHMEM_COLL_BUFSIZE  (64 * 1024)
+
 struct sysv_team
 {
   struct sysv_barrier  barr;
   dart_team_t          teamid;
   int                  inuse;
+  /* shared buffer for collective operations, aligned for any basic type */
+  char                 collbuf[SHMEM_COLL_BUFSIZE]
+                         __attribute__((aligned(64)));
 };
 
 
@@ -87,6 +101,9 @@ int shmem_syncarea_delteam(dart_team_t teamid, int numprocs);
 int shmem_syncarea_findteam(dart_team_t teamid);
 int shmem_syncarea_barrier_wait(int slot);
 
+/* buffer for collective operations of the team at slot 'slot' */
+char * shmem_syncarea_collbuf(int slot);
+
 int shmem_syncarea_getunitstate(dart_unit_t unit);
 int shmem_syncarea_setunitstate(dart_unit_t unit, int state);
 
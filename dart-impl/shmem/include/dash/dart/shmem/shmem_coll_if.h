@@ -1,7 +1,49 @@
 #ifndef SHMEM_COLL_IF_H_INCLUDED
 #define SHMEM_COLL_IF_H_INCLUDED
 
+#include <stddef.h>
+
+#include <dash/dart/if/dart_types.h>
 #include <dash/dart/shmem/shmem_p2p_if.h>
 
+#include "extern_c.h"
+EXTERN_C_BEGIN
+
+// Collective operations working in the shared buffer of a team.
+//
+// Data is staged in the team's buffer in the sync area (see
+// SHMEM_COLL_BUFSIZE) in chunks, separated by the team's barrier.
+// 'slot' is the team's slot in the sync area, 'myid' and 'tsize' are
+// the calling unit's ID in and the size of the team.
+// A negative 'root' denotes all units of the team.
+
+int shmem_coll_bcast(int slot, void *buf, size_t nbytes,
+		     int myid, int root);
+
+int shmem_coll_scatter(int slot, const void *sendbuf, void *recvbuf,
+		       size_t nbytes, int myid, int root, size_t tsize);
+
+// Gather 'nsendelem' elements of size 'esize' from every unit at
+// 'recvdispls' in 'recvbuf' of the root. If 'nrecvelem' is NULL, every
+// unit sends 'nsendelem' elements and 'recvdispls' is ignored.
+int shmem_coll_gatherv(int slot, const void *sendbuf, size_t nsendelem,
+		       void *recvbuf, const size_t *nrecvelem,
+		       const size_t *recvdispls, size_t esize,
+		       int myid, int root, size_t tsize);
+
+int shmem_coll_alltoall(int slot, const void *sendbuf, void *recvbuf,
+			size_t nbytes, int myid, size_t tsize);
+
+// Every unit reduces a slice of each chunk staged in the shared buffer.
+int shmem_coll_reduce(int slot, const void *sendbuf, void *recvbuf,
+		      size_t nelem, dart_datatype_t dtype,
+		      dart_operation_t op, int myid, int root, size_t tsize);
+
+// Every unit reduces the staged contributions of the units before it.
+int shmem_coll_exscan(int slot, const void *sendbuf, void *recvbuf,
+		      size_t nelem, dart_datatype_t dtype,
+		      dart_operation_t op, int myid, size_t tsize);
+
+EXTERN_C_END
 
 #endif /* SHMEM_COLL_IF_H_INCLUDED */
@@ -2,6 +2,7 @@
 #define SHMEM_P2P_IF_H_INCLUDED
 
 #include <dash/dart/if/dart_types.h>
+#include <dash/dart/shmem/dart_handle_impl.h>
 
 #include "extern_c.h"
 EXTERN_C_BEGIN
@@ -19,6 +20,20 @@ int dart_shmem_send(void *buf, size_t nbytes,
 int dart_shmem_recv(void *buf, size_t nbytes,
 		    dart_team_t teamid, dart_unit_t source);
 
+// Non-blocking messages between units of DART_TEAM_ALL, matched by
+// source and tag. 'handle' is a WORK_NB_SEND or WORK_NB_RECV handle
+// with 'unit' set to the global ID of the peer.
+
+int dart_shmem_p2p_post(dart_handle_t handle);
+
+// Advance all pending sends and receives of the calling unit
+// without blocking.
+void dart_shmem_p2p_progress();
+
+// Release a handle, or let the progress release it once the
+// operation completed.
+void dart_shmem_p2p_release(dart_handle_t handle);
+
 EXTERN_C_END
 
 #endif /* SHMEM_P2P_IF_H_INCLUDED */
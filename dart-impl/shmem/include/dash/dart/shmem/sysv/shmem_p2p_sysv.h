@@ -14,6 +14,13 @@ typedef struct fifo_pair_struct
   // the file-descriptors used for reading/writing
   dart_unit_t readfrom;
   dart_unit_t writeto;
+
+  // pipes and non-blocking file-descriptors of the tagged messages
+  // (DART_TEAM_ALL only)
+  char *pname_msg_read;
+  char *pname_msg_write;
+  int   msg_readfrom;
+  int   msg_writeto;
 } fifo_pair_t;
 
 fifo_pair_t team2fifos[MAXNUM_TEAMS][MAXSIZE_GROUP];
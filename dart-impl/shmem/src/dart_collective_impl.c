@@ -3,137 +3,192 @@
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/dart/if/dart_team_group.h>
+#include <dash/dart/shmem/dart_shmem.h>
 #include <dash/dart/shmem/shmem_p2p_if.h>
+#include <dash/dart/shmem/shmem_coll_if.h>
 #include <dash/dart/shmem/shmem_logger.h>
 #include <dash/dart/shmem/shmem_barriers_if.h>
 
+/*
+ * Resolves the sync area slot of a team and the calling unit's ID in
+ * and the size of the team, returns DART_ERR_NOTFOUND from the calling
+ * function for unknown teams.
+ */
+#define DART_SHMEM_COLL_TEAM(_team, _slot, _myid, _size)        \
+  int              _slot;                                       \
+  dart_team_unit_t _myid;                                       \
+  size_t           _size;                                       \
+  do {                                                          \
+    _slot = shmem_syncarea_findteam(_team);                     \
+    if (_slot < 0 || _slot >= MAXNUM_TEAMS) {                   \
+      return DART_ERR_NOTFOUND;                                 \
+    }                                                           \
+    dart_team_myid(_team, &_myid);                              \
+    dart_team_size(_team, &_size);                              \
+  } while (0)
+
 dart_ret_t dart_barrier(dart_team_t teamid)
 {
-  dart_ret_t ret;
-
-  if( teamid==DART_TEAM_ALL ) {
-    shmem_syncarea_barrier_wait(0);
-    ret = DART_OK;
-  } else {
-    int slot;
-    slot = shmem_syncarea_findteam(teamid);
-    if( 0<=slot && slot<MAXNUM_TEAMS ) {
-      shmem_syncarea_barrier_wait(slot);
-      ret = DART_OK;
-    } else {
-      ret = DART_ERR_NOTFOUND;
-    }
+  int slot = shmem_syncarea_findteam(teamid);
+  if( 0<=slot && slot<MAXNUM_TEAMS ) {
+    shmem_syncarea_barrier_wait(slot);
+    return DART_OK;
   }
-  
-  return ret;
+  return DART_ERR_NOTFOUND;
 }
 
-dart_ret_t dart_bcast(void *buf, size_t nbytes, 
-		      dart_unit_t root, dart_team_t team)
+dart_ret_t dart_bcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team)
 {
-  //SANITY_CHECK_TEAM(team);
-  dart_unit_t myid;
-  size_t size;
-
-  int i;
-  dart_team_myid(team, &myid);
-  dart_team_size(team, &size);
-
-  // TODO: this barrier was necessary to
-  // make the bcast test case working reliably
-  dart_barrier(team);
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_bcast on team %d, root=%d, tsize=%d", team, root.id, size);
+  shmem_coll_bcast(slot, buf, nelem * dart_shmem_datatype_sizeof(dtype),
+                   myid.id, root.id);
+  return DART_OK;
+}
 
-  DEBUG("dart_bcast on team %d, root=%d, tsize=%d", team, root, size);
-  if( myid==root ) 
-    {
-      for(i=0; i<size; i++) {
-	if( i!=root ) {
-	  DEBUG("dart_bcast sending to %d %d bytes", i, nbytes);
-	  dart_shmem_send(buf, nbytes, team, i);
-	}
-      } 
-  } 
-  else 
-    {
-      DEBUG("dart_bcast receiving from %d %d bytes", root, nbytes);
-      dart_shmem_recv(buf, nbytes, team, root);
-    }
+dart_ret_t dart_scatter(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_team_unit_t     root,
+  dart_team_t          team)
+{
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_scatter on team %d, root=%d, tsize=%d", team, root.id, size);
+  if (shmem_coll_scatter(slot, sendbuf, recvbuf,
+                         nelem * dart_shmem_datatype_sizeof(dtype),
+                         myid.id, root.id, size) != 0) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
 
-  // TODO: this barrier was necessary to
-  // make the bcast test case working reliably
-  dart_barrier(team);
+dart_ret_t dart_gather(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team)
+{
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_gather on team %d, root=%d, tsize=%d", team, root.id, size);
+  if (shmem_coll_gatherv(slot, sendbuf, nelem, recvbuf, NULL, NULL,
+                         dart_shmem_datatype_sizeof(dtype),
+                         myid.id, root.id, size) != 0) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
 
+dart_ret_t dart_allgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team)
+{
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_allgather on team %d, tsize=%d", team, size);
+  if (shmem_coll_gatherv(slot, sendbuf, nelem, recvbuf, NULL, NULL,
+                         dart_shmem_datatype_sizeof(dtype),
+                         myid.id, -1, size) != 0) {
+    return DART_ERR_INVAL;
+  }
   return DART_OK;
 }
 
-dart_ret_t dart_scatter(void *sendbuf, void *recvbuf, size_t nbytes, 
-			dart_unit_t root, dart_team_t team)
+dart_ret_t dart_allgatherv(
+  const void      * sendbuf,
+  size_t            nsendelem,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       team)
 {
-  //SANITY_CHECK_TEAM(team);
-  dart_unit_t myid;
-  size_t size;
-  int i;
-  //explicit casts to avoid warnings!! carefully double check please!
-  char* sbuf = (char*)sendbuf;
-  char* rbuf = (char*)recvbuf;
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_allgatherv on team %d, tsize=%d", team, size);
+  if (shmem_coll_gatherv(slot, sendbuf, nsendelem, recvbuf,
+                         nrecvelem, recvdispls,
+                         dart_shmem_datatype_sizeof(dtype),
+                         myid.id, -1, size) != 0) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
 
-  dart_team_myid( team, &myid);
-  dart_team_size( team, &size);
-  
-  DEBUG("dart_gather on team %d, root=%d, tsize=%d", team,root,size);
-  if( myid == root){
-    for( i = 0; i < size; i++){
-      if( i != root){
-        DEBUG("dart_scatter sending to %d %d bytes",i,nbytes);
-        dart_shmem_send(&sbuf[nbytes*i],nbytes,team,i);
-      }else{
-        memcpy(&sbuf[nbytes*i],rbuf,nbytes);
-      }
-    }
-  }else{
-    DEBUG("dart_scatter receiving from %d %d bytes",root, nbytes);
-    dart_shmem_recv(rbuf,nbytes,team,root);
+dart_ret_t dart_alltoall(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_team_t      team)
+{
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_alltoall on team %d, tsize=%d", team, size);
+  if (shmem_coll_alltoall(slot, sendbuf, recvbuf,
+                          nelem * dart_shmem_datatype_sizeof(dtype),
+                          myid.id, size) != 0) {
+    return DART_ERR_INVAL;
   }
   return DART_OK;
 }
 
-dart_ret_t dart_gather(void *sendbuf, void *recvbuf, size_t nbytes, 
-		       dart_unit_t root, dart_team_t team)
+dart_ret_t dart_reduce(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_unit_t    root,
+  dart_team_t         team)
 {
-  //SANITY_CHECK_TEAM(team);
-  dart_unit_t myid;
-  size_t size;
-  int i;
-  //explicit casts to avoid warnings!! carefully double check please!
-  char* sbuf=(char*)sendbuf;
-  char* rbuf=(char*)recvbuf;
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_reduce on team %d, root=%d, tsize=%d", team, root.id, size);
+  if (shmem_coll_reduce(slot, sendbuf, recvbuf, nelem, dtype, op,
+                        myid.id, root.id, size) != 0) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
 
-  dart_team_myid(team, &myid);
-  dart_team_size(team, &size);
-  DEBUG("dart_gather on team %d, root=%d, tsize=%d", team,root,size);
-  if( myid == root){
-    for( i = 0; i< size; i++){
-      if(i != root){
-        DEBUG("dart_gather receiving from %d %d bytes", i, nbytes);
-        dart_shmem_recv(&rbuf[nbytes*i], nbytes, team, i); 
-      }else{
-        memcpy(&rbuf[nbytes*i],sbuf,nbytes);
-      }
-    }
-  }else{
-    DEBUG("dart_gather sending to %d %d bytes", root, nbytes);
-    dart_shmem_send(sbuf,nbytes,team,root);
+dart_ret_t dart_allreduce(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team)
+{
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_allreduce on team %d, tsize=%d", team, size);
+  if (shmem_coll_reduce(slot, sendbuf, recvbuf, nelem, dtype, op,
+                        myid.id, -1, size) != 0) {
+    return DART_ERR_INVAL;
   }
-  dart_barrier(team);
   return DART_OK;
 }
-  
-dart_ret_t dart_allgather(void *sendbuf, void *recvbuf, size_t nbytes, 
-			  dart_team_t team)
-{ 
-  dart_unit_t root = 0;
-  DEBUG("dart_allgather on team %d, tsize=%d", team, root, size);
-  dart_gather(sendbuf,recvbuf,nbytes,root,team);
-  dart_bcast(recvbuf,nbytes,root,team);
+
+dart_ret_t dart_exscan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team)
+{
+  DART_SHMEM_COLL_TEAM(team, slot, myid, size);
+  DEBUG("dart_exscan on team %d, tsize=%d", team, size);
+  if (shmem_coll_exscan(slot, sendbuf, recvbuf, nelem, dtype, op,
+                        myid.id, size) != 0) {
+    return DART_ERR_INVAL;
+  }
   return DART_OK;
 }
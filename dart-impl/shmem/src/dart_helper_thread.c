@@ -4,6 +4,7 @@
 
 #include <dash/dart/shmem/shmem_p2p_if.h>
 #include <dash/dart/shmem/dart_helper_thread.h>
+#include <dash/dart/shmem/dart_handle_impl.h>
 
 static struct work_queue queue = {
   PTHREAD_MUTEX_INITIALIZER,
@@ -99,6 +100,10 @@ void* dart_helper_thread(void *ptr)
     case WORK_NB_RECV:
       dart_helper_thread_recv( &item );
       break;
+    case WORK_NB_GET:
+    case WORK_NB_PUT:
+      dart_shmem_handle_copy( item.handle );
+      break;
     case WORK_SHUTDOWN:
       pthread_exit(0);
       break;
@@ -7,6 +7,8 @@
 #include <dash/dart/shmem/dart_teams_impl.h>
 #include <dash/dart/shmem/shmem_logger.h>
 
+#include <dash/dart/base/numa.h>
+
 /* TO IMPLEMENT */
 /*
 dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void *addr);
@@ -20,6 +22,10 @@ dart_ret_t dart_team_memalloc_aligned(dart_team_t teamid,
 dart_ret_t dart_team_memfree(dart_team_t teamid, dart_gptr_t gptr);
 */
 
+/* Segment base addresses are not published by this implementation,
+ * dart_gptr_getaddr_fast always falls back to dart_gptr_getaddr: */
+dart_segment_addr_t dart__segment_addr_tab[DART_SEGMENT_ADDR_TAB_SIZE];
+
 dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t gptr,
   void **addr) {
@@ -179,3 +185,11 @@ dart_ret_t dart_team_memfree(
   // TODO: Implement
   return DART_OK;
 }
+
+dart_ret_t dart_mem_place(
+  void                 * addr,
+  size_t                 nbytes,
+  dart_mem_placement_t   placement,
+  int                    numa_id) {
+  return dart__base__numa__place(addr, nbytes, placement, numa_id);
+}
@@ -1,4 +1,6 @@
 
+#include <sched.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <dash/dart/base/logging.h>
@@ -6,124 +8,355 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/shmem/dart_mempool.h>
 #include <dash/dart/shmem/dart_memarea.h>
+#include <dash/dart/shmem/dart_shmem.h>
+#include <dash/dart/shmem/shmem_p2p_if.h>
+#include <dash/dart/shmem/dart_handle_impl.h>
+#include <dash/dart/shmem/dart_helper_thread.h>
 
 dart_ret_t dart_get(
-  void *dest,
-  dart_gptr_t ptr,
-  size_t nbytes)
+  void            * dest,
+  dart_gptr_t       ptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
 {
-  return dart_get_blocking(dest, ptr, nbytes);
+  return dart_get_blocking(dest, ptr, nelem, src_type, dst_type);
 }
 
 dart_ret_t dart_put(
-  dart_gptr_t  ptr,
-  const void * src,
-  size_t       nbytes)
+  dart_gptr_t       ptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
 {
-  return dart_put_blocking(ptr, src, nbytes);
+  return dart_put_blocking(ptr, src, nelem, src_type, dst_type);
 }
 
 /*
- * dart_accumulate_* implementation, to be defined as macro
- * DART_SHMEM_DEFINE_ACCUMULATE(type)
+ * Native address of the element referenced by a global pointer in the
+ * shared memory pool of its segment.
  */
+static char * dart_shmem_gptr_addr(
+  dart_gptr_t ptr)
+{
+  dart_global_unit_t myid;
+  dart_mempoolptr    pool = dart_memarea_get_mempool_by_id(ptr.segid);
+  if (!pool) {
+    return NULL;
+  }
+  dart_myid(&myid);
+  return ((char *)(pool->localbase_addr)) +            /* pool base addr */
+         ((ptr.unitid - myid.id) * (pool->localsz)) +  /* unit offset    */
+         ptr.addr_or_offs.offset;                      /* element offset */
+}
+
+/*
+ * dart_accumulate_* implementation, defined for every basic type by
+ * DART_SHMEM_DEFINE_ACCUMULATE(name, type).
+ *
+ * Integral types use the native fetch-and-op instructions for sum and
+ * bitwise operations, all other operations and floating point types
+ * are implemented as compare-and-swap loops.
+ */
+
+#define DART_SHMEM_REDUCE_ARITH(_a, _b, _op, _res)                  \
+    case DART_OP_MIN     : _res = ((_a) < (_b)) ? (_a) : (_b); break; \
+    case DART_OP_MAX     : _res = ((_a) > (_b)) ? (_a) : (_b); break; \
+    case DART_OP_SUM     : _res = (_a) + (_b);                 break; \
+    case DART_OP_PROD    : _res = (_a) * (_b);                 break; \
+    case DART_OP_REPLACE : _res = (_b);                        break; \
+    case DART_OP_NO_OP   : _res = (_a);                        break;
+
+#define DART_SHMEM_REDUCE_LOGICAL(_a, _b, _op, _res)                \
+    case DART_OP_BAND    : _res = (_a) & (_b);                 break; \
+    case DART_OP_LAND    : _res = (_a) && (_b);                break; \
+    case DART_OP_BOR     : _res = (_a) | (_b);                 break; \
+    case DART_OP_LOR     : _res = (_a) || (_b);                break; \
+    case DART_OP_BXOR    : _res = (_a) ^ (_b);                 break; \
+    case DART_OP_LXOR    : _res = (!(_a)) ? !!(_b) : !(_b);    break;
+
+#define DART_SHMEM_DEFINE_CAS_LOOP(_name, _type, _reduce)                   \
+static dart_ret_t dart_shmem_cas_loop_##_name(                             \
+  _type * addr, _type value, _type * result, dart_operation_t op)          \
+{                                                                          \
+  _type exp_value;                                                         \
+  _type new_value;                                                         \
+  __atomic_load(addr, &exp_value, __ATOMIC_RELAXED);                       \
+  do {                                                                     \
+    switch (op) {                                                          \
+      _reduce(exp_value, value, op, new_value)                             \
+      default:                                                             \
+        DART_LOG_ERROR("dart_accumulate: operation %d not supported "      \
+                       "for type " #_type, (int)op);                       \
+        return DART_ERR_INVAL;                                             \
+    }                                                                      \
+  } while (!__atomic_compare_exchange(addr, &exp_value, &new_value,       \
+                                      0, __ATOMIC_SEQ_CST,                 \
+                                      __ATOMIC_SEQ_CST));                  \
+  *result = exp_value;                                                     \
+  return DART_OK;                                                          \
+}
+
+#define DART_SHMEM_REDUCE_INTEGRAL(_a, _b, _op, _res)  \
+  DART_SHMEM_REDUCE_ARITH(_a, _b, _op, _res)           \
+  DART_SHMEM_REDUCE_LOGICAL(_a, _b, _op, _res)
+
+#define DART_SHMEM_DEFINE_ACCUMULATE(_name, _type)                          \
+DART_SHMEM_DEFINE_CAS_LOOP(_name, _type, DART_SHMEM_REDUCE_INTEGRAL)       \
+static dart_ret_t dart_shmem_fetch_op_##_name(                             \
+  _type * addr, _type value, _type * result, dart_operation_t op)          \
+{                                                                          \
+  switch (op) {                                                            \
+    case DART_OP_SUM :                                                     \
+      *result = __atomic_fetch_add(addr, value, __ATOMIC_SEQ_CST);         \
+      return DART_OK;                                                      \
+    case DART_OP_BAND :                                                    \
+      *result = __atomic_fetch_and(addr, value, __ATOMIC_SEQ_CST);         \
+      return DART_OK;                                                      \
+    case DART_OP_BOR :                                                     \
+      *result = __atomic_fetch_or(addr, value, __ATOMIC_SEQ_CST);          \
+      return DART_OK;                                                      \
+    case DART_OP_BXOR :                                                    \
+      *result = __atomic_fetch_xor(addr, value, __ATOMIC_SEQ_CST);         \
+      return DART_OK;                                                      \
+    case DART_OP_REPLACE :                                                 \
+      *result = __atomic_exchange_n(addr, value, __ATOMIC_SEQ_CST);        \
+      return DART_OK;                                                      \
+    case DART_OP_NO_OP :                                                   \
+      *result = __atomic_load_n(addr, __ATOMIC_SEQ_CST);                   \
+      return DART_OK;                                                      \
+    default :                                                              \
+      return dart_shmem_cas_loop_##_name(addr, value, result, op);         \
+  }                                                                        \
+}                                                                          \
+static dart_ret_t dart_shmem_cas_##_name(                                  \
+  _type * addr, _type value, _type compare, _type * result)                \
+{                                                                          \
+  __atomic_compare_exchange_n(addr, &compare, value, 0,                    \
+                              __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);         \
+  *result = compare;                                                       \
+  return DART_OK;                                                          \
+}
+
+#define DART_SHMEM_DEFINE_ACCUMULATE_FLOAT(_name, _type)                    \
+DART_SHMEM_DEFINE_CAS_LOOP(_name, _type, DART_SHMEM_REDUCE_ARITH)          \
+static dart_ret_t dart_shmem_fetch_op_##_name(                             \
+  _type * addr, _type value, _type * result, dart_operation_t op)          \
+{                                                                          \
+  return dart_shmem_cas_loop_##_name(addr, value, result, op);             \
+}
+
+DART_SHMEM_DEFINE_ACCUMULATE(char,      char)
+DART_SHMEM_DEFINE_ACCUMULATE(short,     short)
+DART_SHMEM_DEFINE_ACCUMULATE(int,       int)
+DART_SHMEM_DEFINE_ACCUMULATE(uint,      unsigned int)
+DART_SHMEM_DEFINE_ACCUMULATE(long,      long)
+DART_SHMEM_DEFINE_ACCUMULATE(ulong,     unsigned long)
+DART_SHMEM_DEFINE_ACCUMULATE(longlong,  long long)
+DART_SHMEM_DEFINE_ACCUMULATE(ulonglong, unsigned long long)
+DART_SHMEM_DEFINE_ACCUMULATE_FLOAT(float,  float)
+DART_SHMEM_DEFINE_ACCUMULATE_FLOAT(double, double)
+
+#define DART_SHMEM_ATOMIC_CASE(_dtype, _name, _type, _call, ...)   \
+  case _dtype :                                                   \
+    return dart_shmem_##_call##_##_name(__VA_ARGS__);
 
-inline int dart_shmem_reduce_int(int a, int b, dart_operation_t op) {
-  switch (op) {
-    case DART_OP_MIN  : return (a < b) ? a : b;
-    case DART_OP_MAX  : return (a > b) ? a : b;
-    case DART_OP_SUM  : return a + b;
-    case DART_OP_PROD : return a * b;
-    case DART_OP_BAND : return a & b;
-    case DART_OP_LAND : return a && b;
-    case DART_OP_BOR  : return a | b;
-    case DART_OP_LOR  : return a || b;
-    case DART_OP_BXOR : return a ^ b;
-    case DART_OP_LXOR : return (!a) ? b : !b;
-    default           : DART_LOG_ERROR("Unknown reduce operation (%d)",
-                                       (int)op);
-                        return 0;
+/*
+ * Apply op to the element at addr of type dtype, the previous value is
+ * stored in result.
+ */
+static dart_ret_t dart_shmem_fetch_op(
+  void             * addr,
+  const void       * value,
+  void             * result,
+  dart_datatype_t    dtype,
+  dart_operation_t   op)
+{
+#define DART_SHMEM_FETCH_OP_CASE(_dtype, _name, _type)                 \
+  DART_SHMEM_ATOMIC_CASE(_dtype, _name, _type, fetch_op,              \
+                         (_type *)addr, *(const _type *)value,        \
+                         (_type *)result, op)
+  switch (dtype) {
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_BYTE,      char,      char)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_SHORT,     short,     short)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_INT,       int,       int)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_UINT,      uint,      unsigned int)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_LONG,      long,      long)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_ULONG,     ulong,     unsigned long)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_LONGLONG,  longlong,  long long)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_ULONGLONG, ulonglong,
+                             unsigned long long)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_FLOAT,     float,     float)
+    DART_SHMEM_FETCH_OP_CASE(DART_TYPE_DOUBLE,    double,    double)
+    default:
+      DART_LOG_ERROR("dart_fetch_and_op: unsupported datatype %d",
+                     (int)dtype);
+      return DART_ERR_INVAL;
   }
+#undef DART_SHMEM_FETCH_OP_CASE
 }
 
 dart_ret_t dart_accumulate(
-  dart_gptr_t      ptr_dest,
-  char  *          values,
-  size_t           nvalues,
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
   dart_datatype_t  dtype,
-  dart_operation_t op,
-  dart_team_t      team)
+  dart_operation_t op)
 {
-  int             * addr;
-  int               poolid;
-  dart_unit_t       myid;
-  dart_mempoolptr   pool;
+  char   result[sizeof(long double)];
+  size_t elem_size = dart_shmem_datatype_sizeof(dtype);
+  char * addr      = dart_shmem_gptr_addr(gptr);
+  if (addr == NULL) {
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_DEBUG("ACC  - t:%d s:%d o:%d, %zu elements, addr: %p",
+                 gptr.unitid, gptr.segid, gptr.addr_or_offs.offset,
+                 nelem, addr);
+  for (size_t i = 0; i < nelem; i++) {
+    dart_ret_t ret = dart_shmem_fetch_op(
+                       addr + (i * elem_size),
+                       ((const char *)values) + (i * elem_size),
+                       result, dtype, op);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  return DART_OK;
+}
 
-  if (dtype != DART_TYPE_INT) {
-    DART_LOG_ERROR("dart_accumulate: "
-                   "only datatype DART_TYPE_INT supported");
-    return DART_ERR_INVAL;
+dart_ret_t dart_accumulate_blocking_local(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op)
+{
+  return dart_accumulate(gptr, values, nelem, dtype, op);
+}
+
+dart_ret_t dart_fetch_and_op(
+  dart_gptr_t      gptr,
+  const void *     value,
+  void *           result,
+  dart_datatype_t  dtype,
+  dart_operation_t op)
+{
+  char * addr = dart_shmem_gptr_addr(gptr);
+  if (addr == NULL) {
+    return DART_ERR_OTHER;
   }
+  return dart_shmem_fetch_op(addr, value, result, dtype, op);
+}
 
-  dart_myid(&myid);
-  poolid = ptr_dest.segid;
-  pool   = dart_memarea_get_mempool_by_id(poolid);
-  if(!pool) {
+dart_ret_t dart_compare_and_swap(
+  dart_gptr_t      gptr,
+  const void     * value,
+  const void     * compare,
+  void           * result,
+  dart_datatype_t  dtype)
+{
+  char * addr = dart_shmem_gptr_addr(gptr);
+  if (addr == NULL) {
     return DART_ERR_OTHER;
   }
-  addr   = ((int*)(pool->localbase_addr)) +               /* pool base addr */
-           ((ptr_dest.unitid - myid) * (pool->localsz)) + /* unit offset    */
-           ptr_dest.addr_or_offs.offset;                  /* element offset */
-  DART_LOG_DEBUG("ACC  - t:%d o:%d, pool:%d lbase:%p lsz:%d offs:%d",
-                  ptr_dest.unitid,
-                  myid,
-                  poolid,
-                  (int*)(pool->localbase_addr),
-                  pool->localsz,
-                  ptr_dest.addr_or_offs.offset);
-  DART_LOG_DEBUG("ACC  - %d elements, addr: %p", nvalues, addr);
-  for (size_t i = 0; i < nvalues; i++) {
-    int * ptr_src  = &values[i];
-    int * ptr_dest = &addr[i];
-    int exp_value  = *(ptr_dest);
-    int new_value;
-    DART_LOG_DEBUG("ACC  - CAS on element %d (%p) to %d",
-                   i, ptr_dest, new_value);
-    int old_value;
-    /* Compare-and-Swap single elements */
-    for(;;) {
-      new_value = dart_shmem_reduce_int(exp_value, *(ptr_src), op);
-      old_value = __sync_val_compare_and_swap(
-        ptr_dest,
-        exp_value,
-        new_value);
-      if (old_value == exp_value) {
-        /* Assume success, disregarding ABA for now */
-        DART_LOG_DEBUG("ACC  - CAS succeeded on element %d ", i);
-        break;
-      }
-      exp_value = old_value;
-    }
+#define DART_SHMEM_CAS_CASE(_dtype, _name, _type)                      \
+  DART_SHMEM_ATOMIC_CASE(_dtype, _name, _type, cas,                   \
+                         (_type *)addr, *(const _type *)value,        \
+                         *(const _type *)compare, (_type *)result)
+  switch (dtype) {
+    DART_SHMEM_CAS_CASE(DART_TYPE_BYTE,      char,      char)
+    DART_SHMEM_CAS_CASE(DART_TYPE_SHORT,     short,     short)
+    DART_SHMEM_CAS_CASE(DART_TYPE_INT,       int,       int)
+    DART_SHMEM_CAS_CASE(DART_TYPE_UINT,      uint,      unsigned int)
+    DART_SHMEM_CAS_CASE(DART_TYPE_LONG,      long,      long)
+    DART_SHMEM_CAS_CASE(DART_TYPE_ULONG,     ulong,     unsigned long)
+    DART_SHMEM_CAS_CASE(DART_TYPE_LONGLONG,  longlong,  long long)
+    DART_SHMEM_CAS_CASE(DART_TYPE_ULONGLONG, ulonglong,
+                        unsigned long long)
+    default:
+      DART_LOG_ERROR("dart_compare_and_swap: "
+                     "only integral types are supported (%d given)",
+                     (int)dtype);
+      return DART_ERR_INVAL;
+  }
+#undef DART_SHMEM_CAS_CASE
+}
+
+void dart_shmem_handle_copy(
+  dart_handle_t handle)
+{
+  memcpy(handle->dest, handle->src, handle->nbytes);
+  __atomic_store_n(&handle->complete, 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Create the handle of a non-blocking copy and pass it to the helper
+ * thread, if enabled.
+ */
+static dart_ret_t dart_shmem_copy_handle(
+  int             selector,
+  void          * dest,
+  const void    * src,
+  size_t          nbytes,
+  dart_handle_t * handleptr)
+{
+  dart_handle_t handle = malloc(sizeof(struct dart_handle_struct));
+  if (handle == NULL) {
+    *handleptr = DART_HANDLE_NULL;
+    return DART_ERR_OTHER;
   }
+  handle->selector = selector;
+  handle->dest     = dest;
+  handle->src      = src;
+  handle->nbytes   = nbytes;
+  handle->team     = DART_TEAM_ALL;
+  handle->unit     = DART_UNDEFINED_UNIT_ID;
+  handle->complete = 0;
+#ifdef USE_HELPER_THREAD
+  work_item_t item;
+  item.selector = selector;
+  item.handle   = handle;
+  dart_work_queue_push_item(&item);
+#endif // USE_HELPER_THREAD
+  *handleptr = handle;
   return DART_OK;
 }
 
 dart_ret_t dart_get_handle(
-  void *dest,
-  dart_gptr_t ptr,
-	size_t nbytes,
-  dart_handle_t *handle)
+  void            * dest,
+  dart_gptr_t       ptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_handle_t   * handle)
 {
-  return DART_ERR_OTHER;
+  char * addr = dart_shmem_gptr_addr(ptr);
+  *handle = DART_HANDLE_NULL;
+  if (addr == NULL) {
+    return DART_ERR_OTHER;
+  }
+  return dart_shmem_copy_handle(
+           WORK_NB_GET, dest, addr,
+           nelem * dart_shmem_datatype_sizeof(src_type), handle);
 }
 
 dart_ret_t dart_put_handle(
-  dart_gptr_t     ptr,
-  const void    * src,
-	size_t          nbytes,
-  dart_handle_t * handle)
+  dart_gptr_t       ptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_handle_t   * handle)
 {
-  return DART_ERR_OTHER;
+  char * addr = dart_shmem_gptr_addr(ptr);
+  *handle = DART_HANDLE_NULL;
+  if (addr == NULL) {
+    return DART_ERR_OTHER;
+  }
+  return dart_shmem_copy_handle(
+           WORK_NB_PUT, addr, src,
+           nelem * dart_shmem_datatype_sizeof(src_type), handle);
 }
 
 dart_ret_t dart_flush(
@@ -154,18 +387,86 @@ dart_ret_t dart_flush_local_all(
   return DART_OK;
 }
 
+/*
+ * Complete the operation of a handle and release the handle.
+ * Copies offloaded to the helper thread are only waited for if
+ * \c blocking is set, \c *is_finished is set to 0 if the copy is still
+ * pending.
+ */
+static dart_ret_t dart_shmem_handle_complete(
+  dart_handle_t * handleptr,
+  int             blocking,
+  int32_t       * is_finished)
+{
+  dart_ret_t    ret    = DART_OK;
+  dart_handle_t handle = *handleptr;
+  *is_finished = 1;
+  if (handle == DART_HANDLE_NULL) {
+    return DART_OK;
+  }
+  if (handle->selector == WORK_NB_SEND ||
+      handle->selector == WORK_NB_RECV) {
+    // progress all pending messages, not only the tested one, so that
+    // units waiting on each other do not block their peers
+    dart_shmem_p2p_progress();
+    while (!handle->complete) {
+      if (!blocking) {
+        *is_finished = 0;
+        return DART_OK;
+      }
+      sched_yield();
+      dart_shmem_p2p_progress();
+    }
+    ret = handle->status;
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart_wait: %s unit %d failed",
+                     (handle->selector == WORK_NB_SEND)
+                     ? "send to" : "receive from",
+                     handle->unit);
+    }
+  } else {
+#ifdef USE_HELPER_THREAD
+    while (!__atomic_load_n(&handle->complete, __ATOMIC_ACQUIRE)) {
+      if (!blocking) {
+        *is_finished = 0;
+        return DART_OK;
+      }
+      sched_yield();
+    }
+#else
+    dart_shmem_handle_copy(handle);
+#endif // USE_HELPER_THREAD
+  }
+  free(handle);
+  *handleptr = DART_HANDLE_NULL;
+  return ret;
+}
+
 dart_ret_t dart_wait(
-  dart_handle_t handle)
+  dart_handle_t * handle)
 {
-  // TODO: Not implemented
-  return DART_ERR_OTHER;
+  int32_t is_finished;
+  return dart_shmem_handle_complete(handle, 1, &is_finished);
+}
+
+dart_ret_t dart_wait_local(
+  dart_handle_t * handle)
+{
+  return dart_wait(handle);
 }
 
 dart_ret_t dart_test(
-  dart_handle_t handle)
+  dart_handle_t * handle,
+  int32_t       * is_finished)
+{
+  return dart_shmem_handle_complete(handle, 0, is_finished);
+}
+
+dart_ret_t dart_test_local(
+  dart_handle_t * handle,
+  int32_t       * is_finished)
 {
-  // TODO: Not implemented
-  return DART_ERR_OTHER;
+  return dart_test(handle, is_finished);
 }
 
 dart_ret_t dart_waitall_local(
@@ -179,66 +480,154 @@ dart_ret_t dart_waitall(
   dart_handle_t *handle,
   size_t n)
 {
-  return DART_ERR_OTHER;
+  dart_ret_t ret = DART_OK;
+  for (size_t i = 0; handle != NULL && i < n; i++) {
+    if (dart_wait(&handle[i]) != DART_OK) {
+      ret = DART_ERR_OTHER;
+    }
+  }
+  return ret;
 }
 
 dart_ret_t dart_testall(
-  dart_handle_t *handle,
-  size_t n)
+  dart_handle_t * handle,
+  size_t          n,
+  int32_t       * is_finished)
 {
-  // TODO: Not implemented
-  return DART_ERR_OTHER;
+  dart_ret_t ret = DART_OK;
+  *is_finished = 1;
+  for (size_t i = 0; handle != NULL && i < n; i++) {
+    int32_t finished;
+    if (dart_test(&handle[i], &finished) != DART_OK) {
+      ret = DART_ERR_OTHER;
+    }
+    if (!finished) {
+      *is_finished = 0;
+    }
+  }
+  return ret;
 }
 
-dart_ret_t dart_get_blocking(
-  void *dest,
-	dart_gptr_t ptr,
-  size_t nbytes)
+dart_ret_t dart_testall_local(
+  dart_handle_t * handle,
+  size_t          n,
+  int32_t       * is_finished)
 {
-  char *addr;
-  int poolid;
-  dart_unit_t myid;
-  dart_mempoolptr pool;
+  return dart_testall(handle, n, is_finished);
+}
 
-  poolid = ptr.segid;
-  pool = dart_memarea_get_mempool_by_id(poolid);
+dart_ret_t dart_handle_free(
+  dart_handle_t * handle)
+{
+  if (handle != NULL && *handle != DART_HANDLE_NULL) {
+    if ((*handle)->selector == WORK_NB_SEND ||
+        (*handle)->selector == WORK_NB_RECV) {
+      dart_shmem_p2p_release(*handle);
+      *handle = DART_HANDLE_NULL;
+      return DART_OK;
+    }
+#ifdef USE_HELPER_THREAD
+    // the helper thread must not access a released handle:
+    return dart_wait(handle);
+#endif // USE_HELPER_THREAD
+    free(*handle);
+    *handle = DART_HANDLE_NULL;
+  }
+  return DART_OK;
+}
 
-  if(!pool)
+/*
+ * Create the handle of a non-blocking send or receive and post it.
+ * The handle is released right away if the operation completed
+ * immediately.
+ */
+static dart_ret_t dart_shmem_p2p_handle(
+  int                  selector,
+  void               * dest,
+  const void         * src,
+  size_t               nbytes,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handleptr)
+{
+  dart_ret_t    ret;
+  dart_handle_t handle = malloc(sizeof(struct dart_handle_struct));
+  *handleptr = DART_HANDLE_NULL;
+  if (handle == NULL) {
     return DART_ERR_OTHER;
+  }
+  handle->selector = selector;
+  handle->dest     = dest;
+  handle->src      = src;
+  handle->nbytes   = nbytes;
+  handle->team     = DART_TEAM_ALL;
+  handle->unit     = unit.id;
+  handle->tag      = tag;
+  if (dart_shmem_p2p_post(handle) != 0) {
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  if (handle->complete) {
+    ret = handle->status;
+    free(handle);
+    return ret;
+  }
+  *handleptr = handle;
+  return DART_OK;
+}
 
-  dart_myid(&myid);
+dart_ret_t dart_isend(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handle)
+{
+  return dart_shmem_p2p_handle(
+           WORK_NB_SEND, NULL, sendbuf,
+           nelem * dart_shmem_datatype_sizeof(dtype), tag, unit, handle);
+}
 
-  addr = ((char*)pool->localbase_addr) +
-    ((ptr.unitid-myid)*(pool->localsz)) +
-    ptr.addr_or_offs.offset;
+dart_ret_t dart_irecv(
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handle)
+{
+  return dart_shmem_p2p_handle(
+           WORK_NB_RECV, recvbuf, NULL,
+           nelem * dart_shmem_datatype_sizeof(dtype), tag, unit, handle);
+}
 
-  memcpy(dest, addr, nbytes);
+dart_ret_t dart_get_blocking(
+  void            * dest,
+  dart_gptr_t       ptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
+{
+  char * addr = dart_shmem_gptr_addr(ptr);
+  if (addr == NULL) {
+    return DART_ERR_OTHER;
+  }
+  memcpy(dest, addr, nelem * dart_shmem_datatype_sizeof(src_type));
   return DART_OK;
 }
 
 dart_ret_t dart_put_blocking(
-  dart_gptr_t  ptr,
-  const void * src,
-  size_t       nbytes)
+  dart_gptr_t       ptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
 {
-  char *addr;
-  int poolid;
-  dart_unit_t myid;
-  dart_mempoolptr pool;
-
-  poolid = ptr.segid;
-  pool = dart_memarea_get_mempool_by_id(poolid);
-
-  if(!pool)
+  char * addr = dart_shmem_gptr_addr(ptr);
+  if (addr == NULL) {
     return DART_ERR_OTHER;
-
-  dart_myid(&myid);
-
-  addr = ((char*)pool->localbase_addr) +
-    ((ptr.unitid-myid)*(pool->localsz)) +
-    ptr.addr_or_offs.offset;
-
-  memcpy(addr, src, nbytes);
+  }
+  memcpy(addr, src, nelem * dart_shmem_datatype_sizeof(src_type));
   return DART_OK;
 }
-
@@ -1,9 +1,12 @@
 
 #include <stdlib.h>
+#include <limits.h>
 #include <sys/ipc.h>
 #include <sys/shm.h>
 #include <pthread.h>
 #include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 
 #ifdef USE_EVENTFD
 #include <sys/eventfd.h>
@@ -190,56 +193,60 @@ int shmem_syncarea_barrier_wait(int slot)
 }
 
 
+char * shmem_syncarea_collbuf(int slot)
+{
+  if( 0<=slot && slot<MAXNUM_TEAMS ) {
+    return (area->teams[slot]).collbuf;
+  }
+  return NULL;
+}
+
+// number of polls of the barrier generation before sleeping in a futex
+#define SYSV_BARRIER_SPIN_COUNT  4096
+
 int sysv_barrier_create(sysv_barrier_t barrier, int num_procs)
 {
-  pthread_mutexattr_t mutex_shared_attr;
-  PTHREAD_SAFE(pthread_mutexattr_init(&mutex_shared_attr));
-  PTHREAD_SAFE(pthread_mutexattr_setpshared(&mutex_shared_attr, 
-					    PTHREAD_PROCESS_SHARED));
-  PTHREAD_SAFE(pthread_mutex_init(&(barrier->mutex), &mutex_shared_attr));
-  PTHREAD_SAFE(pthread_mutexattr_destroy(&mutex_shared_attr));
-  
-  pthread_condattr_t cond_shared_attr;
-  PTHREAD_SAFE(pthread_condattr_init(&cond_shared_attr));
-  PTHREAD_SAFE(pthread_condattr_setpshared(&cond_shared_attr, 
-					   PTHREAD_PROCESS_SHARED));
-  PTHREAD_SAFE(pthread_cond_init(&(barrier->cond), &cond_shared_attr));
-  PTHREAD_SAFE(pthread_condattr_destroy(&cond_shared_attr));
-  
-  barrier->num_procs = num_procs;
+  barrier->num_procs   = num_procs;
   barrier->num_waiting = 0;
-  
+  barrier->generation  = 0;
+  __atomic_thread_fence(__ATOMIC_RELEASE);
   return 0;
 }
 
 int sysv_barrier_destroy(sysv_barrier_t barrier)
 {
-  PTHREAD_SAFE(pthread_cond_destroy(&(barrier->cond)));
-  //
-  // TODO: if the following call is checked with the 
-  // PTHREAD_SAFE macro, then we're getting spurious 
-  // "device or resource busy" messages;
-  // As a workaround, I've removed the PTHREAD_SAFE
-  // call for now (KF)
-  //
-  pthread_mutex_destroy(&(barrier->mutex));
   return 0;
 }
 
 int sysv_barrier_await(sysv_barrier_t barrier)
 {
-  PTHREAD_SAFE(pthread_mutex_lock(&(barrier->mutex)));
-  (barrier->num_waiting)++;
-  if (barrier->num_waiting < barrier->num_procs)
+  int generation = __atomic_load_n(&(barrier->generation),
+                                   __ATOMIC_ACQUIRE);
+  if (__atomic_add_fetch(&(barrier->num_waiting), 1, __ATOMIC_ACQ_REL)
+      == barrier->num_procs)
+    {
+      // last unit to arrive, release the waiting units:
+      __atomic_store_n(&(barrier->num_waiting), 0, __ATOMIC_RELAXED);
+      __atomic_add_fetch(&(barrier->generation), 1, __ATOMIC_RELEASE);
+      syscall(SYS_futex, &(barrier->generation), FUTEX_WAKE,
+              INT_MAX, NULL, NULL, 0);
+      return 0;
+    }
+  int spin;
+  for (spin = 0; spin < SYSV_BARRIER_SPIN_COUNT; spin++)
     {
-      PTHREAD_SAFE(pthread_cond_wait(&(barrier->cond), &(barrier->mutex)));
+      if (__atomic_load_n(&(barrier->generation), __ATOMIC_ACQUIRE)
+          != generation) {
+        return 0;
+      }
     }
-  else
+  while (__atomic_load_n(&(barrier->generation), __ATOMIC_ACQUIRE)
+         == generation)
     {
-      barrier->num_waiting = 0;
-      PTHREAD_SAFE(pthread_cond_broadcast(&(barrier->cond)));
+      // returns immediately if the generation already advanced:
+      syscall(SYS_futex, &(barrier->generation), FUTEX_WAIT,
+              generation, NULL, NULL, 0);
     }
-  PTHREAD_SAFE(pthread_mutex_unlock(&(barrier->mutex)));
   return 0;
 }
 
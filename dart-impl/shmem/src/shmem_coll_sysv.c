@@ -1,2 +1,345 @@
 
+#include <string.h>
 
+#include <dash/dart/shmem/dart_shmem.h>
+#include <dash/dart/shmem/shmem_coll_if.h>
+#include <dash/dart/shmem/shmem_logger.h>
+#include <dash/dart/shmem/shmem_barriers_if.h>
+
+#define SHMEM_COLL_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+/*
+ * Element-wise reduction a[i] = a[i] op b[i], defined for every basic
+ * type by SHMEM_COLL_DEFINE_REDUCE(name, type).
+ */
+
+#define SHMEM_COLL_OP(_op, _expr)                                   \
+    case _op :                                                      \
+      for (i = 0; i < n; i++) { a[i] = (_expr); }                   \
+      return 0;
+
+#define SHMEM_COLL_OPS_ARITH                                        \
+    SHMEM_COLL_OP(DART_OP_MIN,  (b[i] < a[i]) ? b[i] : a[i])        \
+    SHMEM_COLL_OP(DART_OP_MAX,  (b[i] > a[i]) ? b[i] : a[i])        \
+    SHMEM_COLL_OP(DART_OP_SUM,  a[i] + b[i])                        \
+    SHMEM_COLL_OP(DART_OP_PROD, a[i] * b[i])
+
+#define SHMEM_COLL_OPS_LOGICAL                                      \
+    SHMEM_COLL_OP(DART_OP_BAND, a[i] & b[i])                        \
+    SHMEM_COLL_OP(DART_OP_LAND, a[i] && b[i])                       \
+    SHMEM_COLL_OP(DART_OP_BOR,  a[i] | b[i])                        \
+    SHMEM_COLL_OP(DART_OP_LOR,  a[i] || b[i])                       \
+    SHMEM_COLL_OP(DART_OP_BXOR, a[i] ^ b[i])                        \
+    SHMEM_COLL_OP(DART_OP_LXOR, (!a[i]) ? !!b[i] : !b[i])
+
+#define SHMEM_COLL_DEFINE_REDUCE_OPS(_name, _type, _ops)            \
+static int shmem_coll_reduce_##_name(                               \
+  void *inout, const void *in, size_t n, dart_operation_t op)       \
+{                                                                   \
+  _type       * a = (_type *)inout;                                 \
+  const _type * b = (const _type *)in;                              \
+  size_t        i;                                                  \
+  switch (op) {                                                     \
+    _ops                                                            \
+    default:                                                        \
+      return -1;                                                    \
+  }                                                                 \
+}
+
+#define SHMEM_COLL_DEFINE_REDUCE(_name, _type)                      \
+  SHMEM_COLL_DEFINE_REDUCE_OPS(_name, _type,                        \
+    SHMEM_COLL_OPS_ARITH SHMEM_COLL_OPS_LOGICAL)
+
+#define SHMEM_COLL_DEFINE_REDUCE_FLOAT(_name, _type)                \
+  SHMEM_COLL_DEFINE_REDUCE_OPS(_name, _type, SHMEM_COLL_OPS_ARITH)
+
+SHMEM_COLL_DEFINE_REDUCE(char,      char)
+SHMEM_COLL_DEFINE_REDUCE(short,     short)
+SHMEM_COLL_DEFINE_REDUCE(int,       int)
+SHMEM_COLL_DEFINE_REDUCE(uint,      unsigned int)
+SHMEM_COLL_DEFINE_REDUCE(long,      long)
+SHMEM_COLL_DEFINE_REDUCE(ulong,     unsigned long)
+SHMEM_COLL_DEFINE_REDUCE(longlong,  long long)
+SHMEM_COLL_DEFINE_REDUCE(ulonglong, unsigned long long)
+SHMEM_COLL_DEFINE_REDUCE_FLOAT(float,      float)
+SHMEM_COLL_DEFINE_REDUCE_FLOAT(double,     double)
+SHMEM_COLL_DEFINE_REDUCE_FLOAT(longdouble, long double)
+
+typedef int (*shmem_coll_reduce_fn)(
+  void *inout, const void *in, size_t n, dart_operation_t op);
+
+static shmem_coll_reduce_fn shmem_coll_reduce_fn_get(dart_datatype_t dtype)
+{
+  switch (dtype) {
+    case DART_TYPE_BYTE        : return shmem_coll_reduce_char;
+    case DART_TYPE_SHORT       : return shmem_coll_reduce_short;
+    case DART_TYPE_INT         : return shmem_coll_reduce_int;
+    case DART_TYPE_UINT        : return shmem_coll_reduce_uint;
+    case DART_TYPE_LONG        : return shmem_coll_reduce_long;
+    case DART_TYPE_ULONG       : return shmem_coll_reduce_ulong;
+    case DART_TYPE_LONGLONG    : return shmem_coll_reduce_longlong;
+    case DART_TYPE_ULONGLONG   : return shmem_coll_reduce_ulonglong;
+    case DART_TYPE_FLOAT       : return shmem_coll_reduce_float;
+    case DART_TYPE_DOUBLE      : return shmem_coll_reduce_double;
+    case DART_TYPE_LONG_DOUBLE : return shmem_coll_reduce_longdouble;
+    default                    : return NULL;
+  }
+}
+
+
+int shmem_coll_bcast(int slot, void *buf, size_t nbytes,
+		     int myid, int root)
+{
+  char  *collbuf = shmem_syncarea_collbuf(slot);
+  size_t offs, len;
+
+  for (offs = 0; offs < nbytes; offs += len) {
+    len = SHMEM_COLL_MIN(nbytes - offs, SHMEM_COLL_BUFSIZE);
+    if (myid == root) {
+      memcpy(collbuf, (char *)buf + offs, len);
+    }
+    shmem_syncarea_barrier_wait(slot);
+    if (myid != root) {
+      memcpy((char *)buf + offs, collbuf, len);
+    }
+    shmem_syncarea_barrier_wait(slot);
+  }
+  return 0;
+}
+
+int shmem_coll_scatter(int slot, const void *sendbuf, void *recvbuf,
+		       size_t nbytes, int myid, int root, size_t tsize)
+{
+  char  *collbuf = shmem_syncarea_collbuf(slot);
+  size_t chunk   = SHMEM_COLL_BUFSIZE / tsize;
+  size_t offs, len, i;
+
+  if (chunk == 0) {
+    ERROR("shmem_coll_scatter: team size %d exceeds the buffer size",
+	  (int)tsize);
+    return -1;
+  }
+
+  for (offs = 0; offs < nbytes; offs += len) {
+    len = SHMEM_COLL_MIN(nbytes - offs, chunk);
+    if (myid == root) {
+      for (i = 0; i < tsize; i++) {
+	memcpy(collbuf + i * chunk,
+	       (const char *)sendbuf + i * nbytes + offs, len);
+      }
+    }
+    shmem_syncarea_barrier_wait(slot);
+    memcpy((char *)recvbuf + offs, collbuf + myid * chunk, len);
+    shmem_syncarea_barrier_wait(slot);
+  }
+  return 0;
+}
+
+int shmem_coll_gatherv(int slot, const void *sendbuf, size_t nsendelem,
+		       void *recvbuf, const size_t *nrecvelem,
+		       const size_t *recvdispls, size_t esize,
+		       int myid, int root, size_t tsize)
+{
+  char  *collbuf = shmem_syncarea_collbuf(slot);
+  size_t chunk   = SHMEM_COLL_BUFSIZE / tsize;
+  size_t maxbytes, offs, i;
+
+  if (chunk == 0) {
+    ERROR("shmem_coll_gatherv: team size %d exceeds the buffer size",
+	  (int)tsize);
+    return -1;
+  }
+  maxbytes = nsendelem * esize;
+  if (nrecvelem != NULL) {
+    maxbytes = 0;
+    for (i = 0; i < tsize; i++) {
+      if (nrecvelem[i] * esize > maxbytes) {
+	maxbytes = nrecvelem[i] * esize;
+      }
+    }
+  }
+
+  for (offs = 0; offs < maxbytes; offs += chunk) {
+    size_t sendbytes = nsendelem * esize;
+    if (offs < sendbytes) {
+      memcpy(collbuf + myid * chunk, (const char *)sendbuf + offs,
+	     SHMEM_COLL_MIN(sendbytes - offs, chunk));
+    }
+    shmem_syncarea_barrier_wait(slot);
+    if (root < 0 || myid == root) {
+      for (i = 0; i < tsize; i++) {
+	size_t recvbytes = (nrecvelem != NULL)
+	                   ? nrecvelem[i] * esize
+	                   : sendbytes;
+	size_t displ     = (nrecvelem != NULL)
+	                   ? recvdispls[i] * esize
+	                   : i * sendbytes;
+	if (offs < recvbytes) {
+	  memcpy((char *)recvbuf + displ + offs, collbuf + i * chunk,
+		 SHMEM_COLL_MIN(recvbytes - offs, chunk));
+	}
+      }
+    }
+    shmem_syncarea_barrier_wait(slot);
+  }
+  return 0;
+}
+
+int shmem_coll_alltoall(int slot, const void *sendbuf, void *recvbuf,
+			size_t nbytes, int myid, size_t tsize)
+{
+  int root;
+  // every unit scatters its send buffer in turn
+  for (root = 0; root < (int)tsize; root++) {
+    if (shmem_coll_scatter(slot, sendbuf, (char *)recvbuf + root * nbytes,
+			   nbytes, myid, root, tsize) != 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/*
+ * Fallback of shmem_coll_reduce and shmem_coll_exscan for teams whose
+ * contributions do not fit side by side in the buffer: the units fold
+ * their contribution into the buffer one after another. For an
+ * exclusive scan, every unit takes the partial result before it adds
+ * its own contribution.
+ */
+static void shmem_coll_reduce_serial(int slot, const void *sendbuf,
+				     void *recvbuf, size_t nelem,
+				     size_t esize,
+				     shmem_coll_reduce_fn reduce,
+				     dart_operation_t op, int myid,
+				     int root, int exscan, size_t tsize)
+{
+  char  *collbuf = shmem_syncarea_collbuf(slot);
+  size_t chunk   = SHMEM_COLL_BUFSIZE / esize;
+  size_t offs, len, i;
+
+  for (offs = 0; offs < nelem; offs += len) {
+    const char *in = (const char *)sendbuf + offs * esize;
+    len = SHMEM_COLL_MIN(nelem - offs, chunk);
+    if (myid == 0) {
+      memcpy(collbuf, in, len * esize);
+    }
+    shmem_syncarea_barrier_wait(slot);
+    for (i = 1; i < tsize; i++) {
+      if ((size_t)myid == i) {
+	if (exscan) {
+	  memcpy((char *)recvbuf + offs * esize, collbuf, len * esize);
+	}
+	reduce(collbuf, in, len, op);
+      }
+      shmem_syncarea_barrier_wait(slot);
+    }
+    if (!exscan && (root < 0 || myid == root)) {
+      memcpy((char *)recvbuf + offs * esize, collbuf, len * esize);
+    }
+    shmem_syncarea_barrier_wait(slot);
+  }
+}
+
+int shmem_coll_reduce(int slot, const void *sendbuf, void *recvbuf,
+		      size_t nelem, dart_datatype_t dtype,
+		      dart_operation_t op, int myid, int root, size_t tsize)
+{
+  char  *collbuf = shmem_syncarea_collbuf(slot);
+  size_t esize   = dart_shmem_datatype_sizeof(dtype);
+  size_t chunk   = SHMEM_COLL_BUFSIZE / (tsize * esize);
+  size_t offs, len, i;
+  shmem_coll_reduce_fn reduce = shmem_coll_reduce_fn_get(dtype);
+
+  if (reduce == NULL) {
+    ERROR("shmem_coll_reduce: unsupported datatype %d", (int)dtype);
+    return -1;
+  }
+  // checked up front so that every unit of the team returns the error,
+  // not only the units that reduce a slice:
+  if (reduce(collbuf, collbuf, 0, op) != 0) {
+    ERROR("shmem_coll_reduce: unsupported operation %d", (int)op);
+    return -1;
+  }
+  if (esize > SHMEM_COLL_BUFSIZE) {
+    ERROR("shmem_coll_reduce: element size %d exceeds the buffer size",
+	  (int)esize);
+    return -1;
+  }
+  if (chunk == 0) {
+    shmem_coll_reduce_serial(slot, sendbuf, recvbuf, nelem, esize,
+			     reduce, op, myid, root, 0, tsize);
+    return 0;
+  }
+
+  for (offs = 0; offs < nelem; offs += len) {
+    size_t slice_begin, slice_end;
+    len = SHMEM_COLL_MIN(nelem - offs, chunk);
+    // stage the contribution of every unit:
+    memcpy(collbuf + myid * chunk * esize,
+	   (const char *)sendbuf + offs * esize, len * esize);
+    shmem_syncarea_barrier_wait(slot);
+    // reduce a slice of the chunk into the contribution of unit 0:
+    slice_begin = (len * myid) / tsize;
+    slice_end   = (len * (myid + 1)) / tsize;
+    if (slice_end > slice_begin) {
+      for (i = 1; i < tsize; i++) {
+	reduce(collbuf + slice_begin * esize,
+	       collbuf + (i * chunk + slice_begin) * esize,
+	       slice_end - slice_begin, op);
+      }
+    }
+    shmem_syncarea_barrier_wait(slot);
+    if (root < 0 || myid == root) {
+      memcpy((char *)recvbuf + offs * esize, collbuf, len * esize);
+    }
+    shmem_syncarea_barrier_wait(slot);
+  }
+  return 0;
+}
+
+int shmem_coll_exscan(int slot, const void *sendbuf, void *recvbuf,
+		      size_t nelem, dart_datatype_t dtype,
+		      dart_operation_t op, int myid, size_t tsize)
+{
+  char  *collbuf = shmem_syncarea_collbuf(slot);
+  size_t esize   = dart_shmem_datatype_sizeof(dtype);
+  size_t chunk   = SHMEM_COLL_BUFSIZE / (tsize * esize);
+  size_t offs, len, i;
+  shmem_coll_reduce_fn reduce = shmem_coll_reduce_fn_get(dtype);
+
+  if (reduce == NULL) {
+    ERROR("shmem_coll_exscan: unsupported datatype %d", (int)dtype);
+    return -1;
+  }
+  if (reduce(collbuf, collbuf, 0, op) != 0) {
+    ERROR("shmem_coll_exscan: unsupported operation %d", (int)op);
+    return -1;
+  }
+  if (esize > SHMEM_COLL_BUFSIZE) {
+    ERROR("shmem_coll_exscan: element size %d exceeds the buffer size",
+	  (int)esize);
+    return -1;
+  }
+  if (chunk == 0) {
+    shmem_coll_reduce_serial(slot, sendbuf, recvbuf, nelem, esize,
+			     reduce, op, myid, -1, 1, tsize);
+    return 0;
+  }
+
+  for (offs = 0; offs < nelem; offs += len) {
+    len = SHMEM_COLL_MIN(nelem - offs, chunk);
+    memcpy(collbuf + myid * chunk * esize,
+	   (const char *)sendbuf + offs * esize, len * esize);
+    shmem_syncarea_barrier_wait(slot);
+    // the result of unit 0 is undefined, like in MPI_Exscan:
+    if (myid > 0) {
+      char *out = (char *)recvbuf + offs * esize;
+      memcpy(out, collbuf, len * esize);
+      for (i = 1; i < (size_t)myid; i++) {
+	reduce(out, collbuf + i * chunk * esize, len, op);
+      }
+    }
+    shmem_syncarea_barrier_wait(slot);
+  }
+  return 0;
+}
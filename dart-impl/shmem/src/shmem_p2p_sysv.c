@@ -1,4 +1,5 @@
 
+#include <errno.h>
 #include <stdlib.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -12,9 +13,51 @@
 #include <dash/dart/shmem/shmem_logger.h>
 #include <dash/dart/shmem/shmem_barriers_if.h>
 
-#ifdef DART_USE_HELPER_THREAD
 #include <dash/dart/shmem/dart_helper_thread.h>
-#endif
+
+/*
+ * Non-blocking messages of dart_isend and dart_irecv.
+ *
+ * Messages are exchanged over a separate pipe for every pair of units
+ * in DART_TEAM_ALL, so they do not interfere with the blocking messages
+ * of dart_shmem_send and dart_shmem_recv. Every message is preceded by
+ * a header with its tag and size. Both ends of the pipes are opened
+ * non-blocking, pending sends and receives advance in
+ * dart_shmem_p2p_progress. Incoming messages are read as soon as they
+ * arrive, also if no matching receive is posted yet, so a send never
+ * waits for the receiver to post its receive.
+ */
+
+typedef struct shmem_p2p_header_struct
+{
+  int    tag;
+  size_t nbytes;
+} shmem_p2p_header_t;
+
+// a message that arrived before a matching receive was posted
+typedef struct shmem_p2p_unexpected_struct
+{
+  shmem_p2p_header_t                   header;
+  char                               * data;
+  struct shmem_p2p_unexpected_struct * next;
+} shmem_p2p_unexpected_t;
+
+typedef struct shmem_p2p_peer_struct
+{
+  // pending sends to and posted receives from the unit, in order
+  dart_handle_t            sends;
+  dart_handle_t            recvs;
+  // the incoming message currently read and the receive it matched
+  shmem_p2p_header_t       header;
+  size_t                   offs;
+  dart_handle_t            match;
+  char                   * data;
+  // received messages without a matching receive, in order
+  shmem_p2p_unexpected_t * unexpected;
+} shmem_p2p_peer_t;
+
+static shmem_p2p_peer_t p2p_peers[MAXSIZE_GROUP];
+static size_t           p2p_nunits = 0;
 
 int dart_shmem_mkfifo(char *pname) {
   if (mkfifo(pname, 0666) < 0)
@@ -36,10 +79,14 @@ int dart_shmem_p2p_init(dart_team_t teamid, size_t tsize,
   sprintf(key, "%s-%d", "sysv", ikey);
   
   for (i = 0; i < tsize; i++) {
-    team2fifos[slot][i].readfrom    = -1;
-    team2fifos[slot][i].writeto     = -1;
-    team2fifos[slot][i].pname_read  = 0;
-    team2fifos[slot][i].pname_write = 0;
+    team2fifos[slot][i].readfrom        = -1;
+    team2fifos[slot][i].writeto         = -1;
+    team2fifos[slot][i].pname_read      = 0;
+    team2fifos[slot][i].pname_write     = 0;
+    team2fifos[slot][i].msg_readfrom    = -1;
+    team2fifos[slot][i].msg_writeto     = -1;
+    team2fifos[slot][i].pname_msg_read  = 0;
+    team2fifos[slot][i].pname_msg_write = 0;
   }
   
   // the unit 'myid' is responsible for creating all named pipes
@@ -61,7 +108,29 @@ int dart_shmem_p2p_init(dart_team_t teamid, size_t tsize,
 	      key, teamid, myid, i);
       
       team2fifos[slot][i].pname_write = strdup(buf);
+
+      if (teamid != DART_TEAM_ALL)
+	continue;
+
+      // pipes of the tagged messages, the reading end is opened
+      // right away so that senders do not have to wait for it
+      sprintf(buf, "/tmp/%s-msg-from-%d-to-%d", key, i, myid);
+      team2fifos[slot][i].pname_msg_read = strdup(buf);
+      dart_shmem_mkfifo(team2fifos[slot][i].pname_msg_read);
+      team2fifos[slot][i].msg_readfrom =
+	open(team2fifos[slot][i].pname_msg_read, O_RDONLY | O_NONBLOCK);
+      if (team2fifos[slot][i].msg_readfrom < 0) {
+	ERRNO("open '%s'", team2fifos[slot][i].pname_msg_read);
+      }
+
+      sprintf(buf, "/tmp/%s-msg-from-%d-to-%d", key, myid, i);
+      team2fifos[slot][i].pname_msg_write = strdup(buf);
+
+      memset(&p2p_peers[i], 0, sizeof(shmem_p2p_peer_t));
     }
+  if (teamid == DART_TEAM_ALL) {
+    p2p_nunits = tsize;
+  }
   return DART_OK;
 }
 
@@ -86,7 +155,28 @@ int dart_shmem_p2p_destroy(dart_team_t teamid, size_t tsize,
 	    ERRNO("unlink '%s'", pname);
 	  pname=0;
 	}
+      if ((pname = team2fifos[slot][i].pname_msg_read))
+	{
+	  shmem_p2p_unexpected_t *msg = p2p_peers[i].unexpected;
+	  while (msg != NULL) {
+	    shmem_p2p_unexpected_t *next = msg->next;
+	    free(msg->data);
+	    free(msg);
+	    msg = next;
+	  }
+	  p2p_peers[i].unexpected = NULL;
+	  if (team2fifos[slot][i].msg_readfrom >= 0)
+	    close(team2fifos[slot][i].msg_readfrom);
+	  if (team2fifos[slot][i].msg_writeto >= 0)
+	    close(team2fifos[slot][i].msg_writeto);
+	  DEBUG("unlinking '%s'", pname);
+	  if (unlink(pname) == -1)
+	    ERRNO("unlink '%s'", pname);
+	}
     }
+  if (teamid == DART_TEAM_ALL) {
+    p2p_nunits = 0;
+  }
   return DART_OK;
 }
 
@@ -171,6 +261,252 @@ int dart_shmem_recv(void *buf, size_t nbytes,
 }
 
 
+static void p2p_append(dart_handle_t *list, dart_handle_t handle)
+{
+  while (*list != NULL) {
+    list = &((*list)->next);
+  }
+  handle->next = NULL;
+  *list = handle;
+}
+
+static void p2p_complete(dart_handle_t handle, dart_ret_t status)
+{
+  handle->status = status;
+  if (handle->detached) {
+    free(handle);
+  } else {
+    handle->complete = 1;
+  }
+}
+
+/*
+ * Copy a message that arrived before the receive was posted.
+ */
+static void p2p_deliver(dart_handle_t handle, shmem_p2p_unexpected_t *msg)
+{
+  if (msg->header.nbytes > handle->nbytes) {
+    ERROR("dart_irecv: message of %d bytes from unit %d truncated",
+	  (int)msg->header.nbytes, handle->unit);
+    memcpy(handle->dest, msg->data, handle->nbytes);
+    p2p_complete(handle, DART_ERR_INVAL);
+  } else {
+    memcpy(handle->dest, msg->data, msg->header.nbytes);
+    p2p_complete(handle, DART_OK);
+  }
+  free(msg->data);
+  free(msg);
+}
+
+static void p2p_progress_sends(dart_unit_t unit)
+{
+  shmem_p2p_peer_t *peer = &p2p_peers[unit];
+  fifo_pair_t      *fifo = &team2fifos[0][unit];
+
+  while (peer->sends != NULL) {
+    dart_handle_t      handle = peer->sends;
+    shmem_p2p_header_t header;
+    ssize_t            ret;
+
+    if (handle->offs == sizeof(header) + handle->nbytes) {
+      peer->sends = handle->next;
+      p2p_complete(handle, DART_OK);
+      continue;
+    }
+    if (fifo->msg_writeto < 0) {
+      fifo->msg_writeto = open(fifo->pname_msg_write,
+			       O_WRONLY | O_NONBLOCK);
+      if (fifo->msg_writeto < 0) {
+	// the receiver did not open its end of the pipe yet
+	if (errno == ENXIO || errno == ENOENT)
+	  return;
+	ERRNO("open '%s'", fifo->pname_msg_write);
+	peer->sends = handle->next;
+	p2p_complete(handle, DART_ERR_OTHER);
+	continue;
+      }
+    }
+    if (handle->offs < sizeof(header)) {
+      header.tag    = handle->tag;
+      header.nbytes = handle->nbytes;
+      ret = write(fifo->msg_writeto, (char *)&header + handle->offs,
+		  sizeof(header) - handle->offs);
+    } else {
+      size_t offs = handle->offs - sizeof(header);
+      ret = write(fifo->msg_writeto, (const char *)handle->src + offs,
+		  handle->nbytes - offs);
+    }
+    if (ret < 0) {
+      if (errno == EAGAIN || errno == EINTR)
+	return;
+      ERRNO("send to unit %d", unit);
+      peer->sends = handle->next;
+      p2p_complete(handle, DART_ERR_OTHER);
+      continue;
+    }
+    handle->offs += ret;
+  }
+}
+
+/*
+ * Match the header of an incoming message with the first posted
+ * receive of the same tag.
+ */
+static void p2p_match(shmem_p2p_peer_t *peer)
+{
+  dart_handle_t *prev = &peer->recvs;
+  dart_handle_t  recv;
+
+  for (recv = peer->recvs; recv != NULL; recv = recv->next) {
+    if (recv->tag == peer->header.tag) {
+      *prev = recv->next;
+      break;
+    }
+    prev = &recv->next;
+  }
+  peer->match = recv;
+  if (recv != NULL && peer->header.nbytes <= recv->nbytes) {
+    peer->data = recv->dest;
+  } else {
+    peer->data = malloc(peer->header.nbytes > 0 ? peer->header.nbytes : 1);
+  }
+}
+
+static void p2p_progress_recvs(dart_unit_t unit)
+{
+  shmem_p2p_peer_t *peer = &p2p_peers[unit];
+  fifo_pair_t      *fifo = &team2fifos[0][unit];
+  size_t            hsize = sizeof(shmem_p2p_header_t);
+
+  if (fifo->msg_readfrom < 0)
+    return;
+
+  while (1) {
+    ssize_t ret;
+
+    if (peer->offs >= hsize &&
+	peer->offs == hsize + peer->header.nbytes) {
+      // the message is complete
+      if (peer->match != NULL && peer->data == peer->match->dest) {
+	p2p_complete(peer->match, DART_OK);
+      } else {
+	shmem_p2p_unexpected_t *msg =
+	  malloc(sizeof(shmem_p2p_unexpected_t));
+	msg->header = peer->header;
+	msg->data   = peer->data;
+	msg->next   = NULL;
+	if (peer->match != NULL) {
+	  // the receive was posted after the message arrived, or its
+	  // buffer is too small
+	  p2p_deliver(peer->match, msg);
+	} else {
+	  shmem_p2p_unexpected_t **last = &peer->unexpected;
+	  while (*last != NULL) {
+	    last = &((*last)->next);
+	  }
+	  *last = msg;
+	}
+      }
+      peer->offs  = 0;
+      peer->match = NULL;
+      peer->data  = NULL;
+      continue;
+    }
+    if (peer->offs < hsize) {
+      ret = read(fifo->msg_readfrom, (char *)&peer->header + peer->offs,
+		 hsize - peer->offs);
+    } else {
+      size_t offs = peer->offs - hsize;
+      ret = read(fifo->msg_readfrom, peer->data + offs,
+		 peer->header.nbytes - offs);
+    }
+    if (ret <= 0) {
+      // no data available, or the sender did not open the pipe yet
+      if (ret < 0 && errno != EAGAIN && errno != EINTR) {
+	ERRNO("receive from unit %d", unit);
+      }
+      return;
+    }
+    peer->offs += ret;
+    if (peer->offs == hsize) {
+      p2p_match(peer);
+    }
+  }
+}
+
+int dart_shmem_p2p_post(dart_handle_t handle)
+{
+  shmem_p2p_peer_t *peer;
+
+  if (handle->unit < 0 || (size_t)handle->unit >= p2p_nunits) {
+    ERROR("dart_shmem_p2p_post: invalid unit %d", handle->unit);
+    return -1;
+  }
+  peer = &p2p_peers[handle->unit];
+  handle->offs     = 0;
+  handle->status   = DART_OK;
+  handle->complete = 0;
+  handle->detached = 0;
+  handle->next     = NULL;
+
+  if (handle->selector == WORK_NB_SEND) {
+    p2p_append(&peer->sends, handle);
+  } else {
+    shmem_p2p_unexpected_t **prev = &peer->unexpected;
+    shmem_p2p_unexpected_t  *msg;
+    for (msg = peer->unexpected; msg != NULL; msg = msg->next) {
+      if (msg->header.tag == handle->tag) {
+	*prev = msg->next;
+	p2p_deliver(handle, msg);
+	return 0;
+      }
+      prev = &msg->next;
+    }
+    if (peer->offs >= sizeof(shmem_p2p_header_t) && peer->match == NULL &&
+	peer->header.tag == handle->tag) {
+      // the message is being read already, it is copied once complete
+      peer->match = handle;
+      dart_shmem_p2p_progress();
+      return 0;
+    }
+    p2p_append(&peer->recvs, handle);
+  }
+  dart_shmem_p2p_progress();
+  return 0;
+}
+
+void dart_shmem_p2p_progress()
+{
+  dart_unit_t unit;
+  for (unit = 0; (size_t)unit < p2p_nunits; unit++) {
+    p2p_progress_recvs(unit);
+    p2p_progress_sends(unit);
+  }
+}
+
+void dart_shmem_p2p_release(dart_handle_t handle)
+{
+  if (handle->complete) {
+    free(handle);
+    return;
+  }
+  if (handle->selector == WORK_NB_RECV) {
+    // a receive that did not match a message yet is dropped
+    shmem_p2p_peer_t *peer = &p2p_peers[handle->unit];
+    dart_handle_t    *prev = &peer->recvs;
+    dart_handle_t     recv;
+    for (recv = peer->recvs; recv != NULL; recv = recv->next) {
+      if (recv == handle) {
+	*prev = recv->next;
+	free(handle);
+	return;
+      }
+      prev = &recv->next;
+    }
+  }
+  handle->detached = 1;
+}
+
 int dart_shmem_isend(void *buf, size_t nbytes, 
 		     dart_team_t teamid, dart_unit_t dest, 
 		     dart_handle_t *handle)
@@ -183,7 +519,7 @@ int dart_shmem_isend(void *buf, size_t nbytes,
   item.nbytes=nbytes;
   item.team=teamid;
   item.unit=dest;
-  item.handle=handle;
+  item.handle=(handle != NULL) ? *handle : DART_HANDLE_NULL;
   
   item.selector = WORK_NB_SEND;
 
@@ -207,7 +543,7 @@ int dart_shmem_irecv(void *buf, size_t nbytes,
   item.nbytes=nbytes;
   item.team=teamid;
   item.unit=source;
-  item.handle=handle;
+  item.handle=(handle != NULL) ? *handle : DART_HANDLE_NULL;
   
   item.selector = WORK_NB_RECV;
   
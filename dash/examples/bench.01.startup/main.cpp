@@ -0,0 +1,179 @@
+/**
+ * Measures the time to initialize and finalize the DASH runtime and to
+ * resolve locality information of the global team.
+ *
+ * Locality information is created on first use by default and eagerly
+ * in dash::init if DART_LOCALITY_EAGER is set. Both variants are measured
+ * in alternating rounds.
+ *
+ * MPI is initialized by the benchmark so DASH can be initialized
+ * repeatedly.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+
+#include <mpi.h>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef struct benchmark_params_t {
+  int    rounds;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  double      init_s;
+  double      locality_s;
+  double      finalize_s;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+measurement evaluate(
+  int * argc, char *** argv, const std::string & testcase);
+
+void print_measurement_header(int myid);
+void print_measurement_record(
+  int                 myid,
+  int                 nunits,
+  const measurement & mes);
+
+static double seconds_since(
+  std::chrono::high_resolution_clock::time_point ts_start)
+{
+  return std::chrono::duration<double>(
+           std::chrono::high_resolution_clock::now() - ts_start).count();
+}
+
+/**
+ * Maximum of a duration over all units, the slowest unit determines the
+ * startup time of the application.
+ */
+static double max_over_units(double value)
+{
+  double max_value = 0;
+  MPI_Allreduce(&value, &max_value, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  return max_value;
+}
+
+int main(int argc, char** argv)
+{
+  MPI_Init(&argc, &argv);
+
+  int myid, nunits;
+  MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+  MPI_Comm_size(MPI_COMM_WORLD, &nunits);
+
+  benchmark_params params = parse_args(argc, argv);
+
+  if (myid == 0) {
+    cout << "bench.01.startup: rounds: " << params.rounds << endl;
+  }
+  print_measurement_header(myid);
+
+  for (int round = 0; round < params.rounds; ++round) {
+    for (auto testcase : { "lazy", "eager" }) {
+      auto mes = evaluate(&argc, &argv, testcase);
+      print_measurement_record(myid, nunits, mes);
+    }
+  }
+
+  if (myid == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  MPI_Finalize();
+  return 0;
+}
+
+measurement evaluate(
+  int * argc, char *** argv, const std::string & testcase)
+{
+  measurement mes;
+  mes.testcase = testcase;
+
+  if (testcase == "eager") {
+    setenv("DART_LOCALITY_EAGER", "1", 1);
+  } else {
+    unsetenv("DART_LOCALITY_EAGER");
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  auto ts_start = std::chrono::high_resolution_clock::now();
+  dash::init(argc, argv);
+  mes.init_s = max_over_units(seconds_since(ts_start));
+
+  // First query of the global team's locality, creates locality
+  // information unless it has been created in dash::init:
+  {
+    ts_start = std::chrono::high_resolution_clock::now();
+    dash::util::TeamLocality tloc(dash::Team::All());
+    mes.locality_s = max_over_units(seconds_since(ts_start));
+  }
+
+  ts_start = std::chrono::high_resolution_clock::now();
+  dash::finalize();
+  mes.finalize_s = max_over_units(seconds_since(ts_start));
+
+  return mes;
+}
+
+void print_measurement_header(int myid)
+{
+  if (myid == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw( 8) << "impl"       << ","
+         << std::setw(12) << "init.s"     << ","
+         << std::setw(12) << "locality.s" << ","
+         << std::setw(12) << "finalize.s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  int                 myid,
+  int                 nunits,
+  const measurement & mes)
+{
+  if (myid == 0) {
+#ifdef DASH_MPI_IMPL_ID
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+#else
+    std::string mpi_impl = "-";
+#endif
+    cout << std::right
+         << std::setw(5) << nunits   << ","
+         << std::setw(9) << mpi_impl << ","
+         << std::setw(8) << mes.testcase << ","
+         << std::fixed << setprecision(6)
+         << std::setw(12) << mes.init_s     << ","
+         << std::setw(12) << mes.locality_s << ","
+         << std::setw(12) << mes.finalize_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.rounds = 5;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-n" && i + 1 < argc) {
+      params.rounds = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
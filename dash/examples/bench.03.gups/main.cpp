@@ -16,6 +16,7 @@
 #include <stdint.h>
 
 #include <iostream>
+#include <vector>
 
 #include <libdash.h>
 
@@ -44,6 +45,7 @@ typedef struct benchmark_params_t {
   size_t size_base;
   size_t num_updates;
   size_t rep_base;
+  size_t batch_size;
   bool   verify;
 } benchmark_params;
 
@@ -109,6 +111,41 @@ void RandomAccessUpdate(const benchmark_params & params)
   }
 }
 
+/**
+ * Applies the same updates as \c RandomAccessUpdate in batches of
+ * \c params.batch_size updates per unit, exchanged with their owners by
+ * \c dash::scatter_accumulate.
+ */
+void RandomAccessUpdateBatched(const benchmark_params & params)
+{
+  uint64_t ran = starts(params.num_updates / dash::size() * dash::myid());
+  auto     table_size = params.size_base;
+  auto     batch_size = params.batch_size;
+  // All units take part in the same number of batches:
+  uint64_t max_updates = (params.num_updates + dash::size() - 1)
+                         / dash::size();
+  uint64_t num_batches = (max_updates + batch_size - 1) / batch_size;
+
+  std::vector<int64_t> indices;
+  std::vector<value_t> values;
+  indices.reserve(batch_size);
+  values.reserve(batch_size);
+  uint64_t i = dash::myid();
+  for (uint64_t b = 0; b < num_batches; ++b) {
+    indices.clear();
+    values.clear();
+    for (; i < params.num_updates && indices.size() < batch_size;
+         i += dash::size()) {
+      ran = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
+      indices.push_back(static_cast<int64_t>(ran & (table_size-1)));
+      values.push_back(ran);
+    }
+    dash::scatter_accumulate(
+      Table, indices.begin(), indices.end(), values.begin(),
+      dash::bit_xor<value_t>());
+  }
+}
+
 uint64_t RandomAccessVerify(const benchmark_params & params)
 {
   uint64_t i, localerrors, errors;
@@ -232,7 +269,11 @@ void perform_test(const benchmark_params & params)
   MPI_Pcontrol(0, "clear");
 #endif
   ts_start    = Timer::Now();
-  RandomAccessUpdate(params);
+  if (params.batch_size > 0) {
+    RandomAccessUpdateBatched(params);
+  } else {
+    RandomAccessUpdate(params);
+  }
   dash::barrier();
   duration_us = Timer::ElapsedSince(ts_start);
 #ifdef DASH_ENABLE_IPM
@@ -253,7 +294,11 @@ void perform_test(const benchmark_params & params)
   // Verification:
   if (params.verify) {
     // do it again
-    RandomAccessUpdate(params);
+    if (params.batch_size > 0) {
+      RandomAccessUpdateBatched(params);
+    } else {
+      RandomAccessUpdate(params);
+    }
     dash::barrier();
     uint64_t errors = RandomAccessVerify(params);
     if (dash::myid() == 0) {
@@ -282,6 +327,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.size_base   = TableSize;
   params.num_updates = NUPDATE;
   params.rep_base    = 1;
+  params.batch_size  = 0;
   params.verify      = false;
 
   for (auto i = 1; i < argc; i += 2) {
@@ -290,6 +336,8 @@ benchmark_params parse_args(int argc, char * argv[])
       params.size_base = atoi(argv[i+1]);
     } else if (flag == "-rb") {
       params.rep_base  = atoi(argv[i+1]);
+    } else if (flag == "-b") {
+      params.batch_size = atoi(argv[i+1]);
     } else if (flag == "-verify") {
       params.verify    = true;
       --i;
@@ -309,6 +357,7 @@ void print_params(
   bench_cfg.print_section_start("Runtime arguments");
   bench_cfg.print_param("-sb",     "size base",    params.size_base);
   bench_cfg.print_param("-rb",     "rep. base",    params.rep_base);
+  bench_cfg.print_param("-b",      "batch size",   params.batch_size);
   bench_cfg.print_param("-verify", "verification", params.verify);
   bench_cfg.print_section_end();
 }
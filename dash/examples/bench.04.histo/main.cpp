@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <libdash.h>
 
 #include "../bench.h"
@@ -8,6 +10,7 @@ using std::endl;
 
 #define NUM_KEYS     (1<<29)
 #define MAX_KEY      (1<<22)
+#define BATCH_SIZE   (1<<20)
 
 /*
 #define NUM_KEYS     32
@@ -88,6 +91,38 @@ int main(int argc, char **argv)
     cout<<"MKeys/sec: "<<(NUM_KEYS*1.0e-6)/(tstop-tstart)<<endl;
   }
 
+  // batched variant: the local keys are sent to the owners of their
+  // histogram bins in batches of BATCH_SIZE keys which are added by
+  // dash::scatter_accumulate
+  dash::Array<int> key_histo_batched(MAX_KEY, dash::BLOCKED);
+  dash::fill(key_histo_batched.begin(), key_histo_batched.end(), 0);
+
+  // all units take part in the same number of batches
+  int num_batches = (key_array.lsize() + BATCH_SIZE - 1) / BATCH_SIZE;
+  int max_batches = 0;
+  dart_allreduce(&num_batches, &max_batches, 1, DART_TYPE_INT,
+                 DART_OP_MAX, dash::Team::All().dart_id());
+  std::vector<int> ones(BATCH_SIZE, 1);
+
+  dash::barrier();
+  TIMESTAMP(tstart);
+
+  for(int b=0; b<max_batches; b++ ) {
+    int first = std::min<int>(b * BATCH_SIZE, key_array.lsize());
+    int last  = std::min<int>(first + BATCH_SIZE, key_array.lsize());
+    dash::scatter_accumulate(
+      key_histo_batched,
+      key_array.lbegin() + first, key_array.lbegin() + last,
+      ones.begin(), dash::plus<int>());
+  }
+  dash::barrier();
+  TIMESTAMP(tstop);
+
+  if(myid==0) {
+    cout<<"MKeys/sec (scatter_accumulate): "
+        <<(NUM_KEYS*1.0e-6)/(tstop-tstart)<<endl;
+  }
+
 #ifdef DBGOUT
   dash::barrier();
   if(myid==0) {
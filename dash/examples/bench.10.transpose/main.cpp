@@ -0,0 +1,293 @@
+/**
+ * Measures the distributed matrix transpose dash::transpose for blocked
+ * and tiled patterns, out-of-place and in-place, and the local
+ * cache-blocked transpose of a unit's block for reference.
+ *
+ * Weak scaling keeps the extent of the local blocks constant, strong
+ * scaling the extent of the matrix. Every measurement is printed as one
+ * comma-separated record.
+ */
+
+#include <libdash.h>
+
+#include <array>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#ifndef DASH_MPI_IMPL_ID
+#define DASH_MPI_IMPL_ID unknown
+#endif
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef dash::default_index_t index_t;
+typedef dash::default_size_t  extent_t;
+typedef double                value_t;
+
+typedef struct benchmark_params_t {
+  extent_t    size_base;
+  extent_t    tile_size;
+  std::string scaling;
+  int         reps;
+  int         rounds;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  extent_t    rows;
+  extent_t    cols;
+  double      time_us;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const measurement      & mes,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+/**
+ * Repeats the given function and prints the mean time of a repetition.
+ */
+void measure(
+  const std::string      & testcase,
+  extent_t                 rows,
+  extent_t                 cols,
+  const benchmark_params & params,
+  std::function<void()>    func)
+{
+  // warmup
+  func();
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (int r = 0; r < params.reps; ++r) {
+    func();
+  }
+  dash::barrier();
+  measurement mes;
+  mes.testcase = testcase;
+  mes.rows     = rows;
+  mes.cols     = cols;
+  mes.time_us  = Timer::ElapsedSince(ts_start) / params.reps;
+  print_measurement_record(mes, params);
+}
+
+void evaluate_blocked(const benchmark_params & params)
+{
+  typedef dash::Matrix<value_t, 2, index_t> matrix_t;
+
+  dash::TeamSpec<2> team_spec;
+  team_spec.balance_extents();
+  extent_t nunits = dash::size();
+  extent_t rows   = (params.scaling == "weak")
+                    ? params.size_base * team_spec.extent(0)
+                    : params.size_base;
+  extent_t cols   = (params.scaling == "weak")
+                    ? params.size_base * team_spec.extent(1)
+                    : params.size_base;
+  if (rows < nunits || cols < nunits) {
+    return;
+  }
+
+  matrix_t src(rows, cols);
+  matrix_t dst(cols, rows);
+  std::fill(src.lbegin(), src.lend(), 1.0);
+  src.barrier();
+
+  measure("blocked", rows, cols, params, [&]() {
+    dash::transpose(src, dst);
+  });
+}
+
+void evaluate_tiled(const benchmark_params & params)
+{
+  typedef dash::TilePattern<2>                        pattern_t;
+  typedef dash::Matrix<value_t, 2, index_t, pattern_t> matrix_t;
+
+  dash::TeamSpec<2> team_spec_src;
+  team_spec_src.balance_extents();
+  dash::TeamSpec<2> team_spec_dst(team_spec_src.extent(1),
+                                  team_spec_src.extent(0));
+  extent_t tile = params.tile_size;
+  extent_t rows = (params.scaling == "weak")
+                  ? params.size_base * team_spec_src.extent(0)
+                  : params.size_base;
+  extent_t cols = (params.scaling == "weak")
+                  ? params.size_base * team_spec_src.extent(1)
+                  : params.size_base;
+  if (rows % (tile * team_spec_src.extent(0)) != 0 ||
+      cols % (tile * team_spec_src.extent(1)) != 0) {
+    if (dash::myid() == 0) {
+      cout << "# skipped: tiles do not divide matrix extents" << endl;
+    }
+    return;
+  }
+
+  matrix_t src(pattern_t(dash::SizeSpec<2>(rows, cols),
+                         dash::DistributionSpec<2>(dash::TILE(tile),
+                                                   dash::TILE(tile)),
+                         team_spec_src));
+  matrix_t dst(pattern_t(dash::SizeSpec<2>(cols, rows),
+                         dash::DistributionSpec<2>(dash::TILE(tile),
+                                                   dash::TILE(tile)),
+                         team_spec_dst));
+  std::fill(src.lbegin(), src.lend(), 1.0);
+  src.barrier();
+
+  measure("tile", rows, cols, params, [&]() {
+    dash::transpose(src, dst);
+  });
+
+  if (rows == cols) {
+    measure("tile.inplace", rows, cols, params, [&]() {
+      dash::transpose(src);
+    });
+  }
+
+  // Local transpose of the unit's memory as one block, lower bound of the
+  // time spent in local transposes:
+  std::vector<const value_t *> src_rows(src.local.extent(0));
+  for (extent_t r = 0; r < src_rows.size(); ++r) {
+    src_rows[r] = src.lbegin() + r * src.local.extent(1);
+  }
+  std::vector<value_t> buf(src.local.size());
+  measure("local", rows, cols, params, [&]() {
+    dash::internal::transpose_local(
+      src_rows, src.local.extent(1), buf.data());
+  });
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.10.transpose");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  for (int round = 0; round < params.rounds; ++round) {
+    evaluate_blocked(params);
+    evaluate_tiled(params);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"     << ","
+         << std::setw( 9) << "mpi.impl"  << ","
+         << std::setw( 7) << "scaling"   << ","
+         << std::setw(13) << "case"      << ","
+         << std::setw( 8) << "rows"      << ","
+         << std::setw( 8) << "cols"      << ","
+         << std::setw( 5) << "tile"      << ","
+         << std::setw(12) << "time.us"   << ","
+         << std::setw(10) << "mb.s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const measurement      & mes,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+    // Every element is read and written once:
+    double mb_s = (2 * mes.rows * mes.cols * sizeof(value_t)) / mes.time_us;
+    cout << std::right
+         << std::setw( 5) << dash::size()     << ","
+         << std::setw( 9) << mpi_impl         << ","
+         << std::setw( 7) << params.scaling   << ","
+         << std::setw(13) << mes.testcase     << ","
+         << std::setw( 8) << mes.rows         << ","
+         << std::setw( 8) << mes.cols         << ","
+         << std::setw( 5) << params.tile_size << ","
+         << std::fixed << setprecision(2)
+         << std::setw(12) << mes.time_us      << ","
+         << std::setw(10) << mb_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base = 0;
+  params.tile_size = 64;
+  params.scaling   = "weak";
+  params.reps      = 10;
+  params.rounds    = 1;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base = static_cast<extent_t>(atoi(argv[i+1]));
+    } else if (flag == "-t") {
+      params.tile_size = static_cast<extent_t>(atoi(argv[i+1]));
+    } else if (flag == "-s") {
+      params.scaling   = argv[i+1];
+    } else if (flag == "-r") {
+      params.reps      = atoi(argv[i+1]);
+    } else if (flag == "-n") {
+      params.rounds    = atoi(argv[i+1]);
+    }
+  }
+  if (params.size_base == 0) {
+    // local extent in weak scaling
+    params.size_base = (params.scaling == "weak") ? 1024 : 4096;
+  }
+  if (params.scaling != "weak" && params.scaling != "strong") {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "Invalid argument: -s <weak|strong>");
+  }
+
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-s",  "scaling (weak|strong)", params.scaling);
+  bench_cfg.print_param("-sb", "size base per dim.",    params.size_base);
+  bench_cfg.print_param("-t",  "tile extent",           params.tile_size);
+  bench_cfg.print_param("-r",  "repetitions per round", params.reps);
+  bench_cfg.print_param("-n",  "rounds",                params.rounds);
+  bench_cfg.print_section_end();
+}
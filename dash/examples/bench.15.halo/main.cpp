@@ -0,0 +1,466 @@
+/**
+ * Measures halo region updates and stencil operator throughput of
+ * dash::halo for 2-D and 3-D matrices with star and box stencils,
+ * different halo widths and memory orders.
+ *
+ * Halo updates are measured blocking, asynchronous with the inner
+ * elements computed meanwhile, in push mode and for all halo regions of
+ * every region level (faces, edges, corners) separately. The stencil
+ * operator is measured for the bulk inner update, the inner iterator and
+ * the boundary iterator.
+ *
+ * Weak scaling keeps the extent of the local blocks constant, strong
+ * scaling the extent of the matrix. Every measurement is printed as one
+ * comma-separated record.
+ *
+ * Matrices are distributed by a BLOCKED dash::Pattern and by a
+ * dash::TilePattern with one tile per unit, which differ in the index
+ * mapping the halo regions are resolved with. The halo wrapper expects
+ * a single rectangular block per unit, so patterns assigning several
+ * tiles to a unit like dash::ShiftTilePattern are not measured.
+ */
+
+#include <libdash.h>
+
+#include <array>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#ifndef DASH_MPI_IMPL_ID
+#define DASH_MPI_IMPL_ID unknown
+#endif
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef dash::default_index_t index_t;
+typedef dash::default_size_t  extent_t;
+typedef double                value_t;
+
+typedef struct benchmark_params_t {
+  extent_t    size_base;
+  std::string scaling;
+  std::string dist;
+  int         width_max;
+  int         ndim;
+  int         reps;
+  int         rounds;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  extent_t    elements;
+  double      time_us;
+} measurement;
+
+typedef struct config_t {
+  int         ndim;
+  std::string dist;
+  std::string order;
+  std::string stencil;
+  int         width;
+} config;
+
+void print_measurement_header();
+void print_measurement_record(
+  const config           & conf,
+  const measurement      & mes,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+/**
+ * Star stencil with the given width: the neighbors in every dimension.
+ */
+template<dash::dim_t NumDimensions>
+dash::halo::StencilSpec<dash::halo::StencilPoint<NumDimensions>,
+                        2 * NumDimensions>
+star_stencil(int width)
+{
+  using StencilP_t = dash::halo::StencilPoint<NumDimensions>;
+
+  std::array<StencilP_t, 2 * NumDimensions> points;
+  for (dash::dim_t d = 0; d < NumDimensions; ++d) {
+    points[2 * d][d]     = -width;
+    points[2 * d + 1][d] = width;
+  }
+  return points;
+}
+
+/**
+ * Box stencil with the given width: the neighbors in all directions,
+ * accesses all halo regions.
+ */
+template<dash::dim_t NumDimensions, std::size_t NumPoints>
+dash::halo::StencilSpec<dash::halo::StencilPoint<NumDimensions>, NumPoints>
+box_stencil(int width)
+{
+  using StencilP_t = dash::halo::StencilPoint<NumDimensions>;
+
+  std::array<StencilP_t, NumPoints> points;
+  std::size_t point = 0;
+  for (std::size_t i = 0; i <= NumPoints; ++i) {
+    StencilP_t stencil;
+    bool       center = true;
+    auto       index  = i;
+    for (dash::dim_t d = NumDimensions; d > 0;) {
+      --d;
+      stencil[d] = (static_cast<int>(index % 3) - 1) * width;
+      center    &= stencil[d] == 0;
+      index     /= 3;
+    }
+    if (!center) {
+      points[point++] = stencil;
+    }
+  }
+  return points;
+}
+
+/**
+ * Runs all measurements for one matrix and stencil configuration.
+ */
+template<typename PatternT, typename StencilSpecT>
+void evaluate(
+  const config           & conf,
+  const StencilSpecT     & stencil_spec,
+  const benchmark_params & params)
+{
+  constexpr auto NumDimensions = PatternT::ndim();
+
+  using Pattern_t = PatternT;
+  using Matrix_t  = dash::Matrix<value_t, NumDimensions, index_t, Pattern_t>;
+  using Halo_t    = dash::halo::HaloMatrixWrapper<Matrix_t>;
+  using GlobBoundSpec_t = dash::halo::GlobalBoundarySpec<NumDimensions>;
+
+  dash::TeamSpec<NumDimensions> team_spec;
+  team_spec.balance_extents();
+
+  std::array<extent_t, NumDimensions>           extents;
+  std::array<dash::Distribution, NumDimensions> dists;
+  for (dash::dim_t d = 0; d < NumDimensions; ++d) {
+    extents[d] = (params.scaling == "weak")
+                 ? params.size_base * team_spec.extent(d)
+                 : params.size_base;
+    if (extents[d] < conf.width * team_spec.extent(d)) {
+      if (dash::myid() == 0) {
+        cout << "# skipped: halo width " << conf.width
+             << " exceeds local extent" << endl;
+      }
+      return;
+    }
+    if (conf.dist == "blocked") {
+      dists[d] = dash::BLOCKED;
+      continue;
+    }
+    // one tile per unit, tiles must not be underfilled
+    if (extents[d] % team_spec.extent(d) != 0) {
+      if (dash::myid() == 0) {
+        cout << "# skipped: extent " << extents[d]
+             << " not divisible into tiles" << endl;
+      }
+      return;
+    }
+    dists[d] = dash::TILE(extents[d] / team_spec.extent(d));
+  }
+
+  Pattern_t pattern(dash::SizeSpec<NumDimensions>(extents),
+                    dash::DistributionSpec<NumDimensions>(dists),
+                    team_spec, dash::Team::All());
+  Matrix_t matrix(pattern);
+  Matrix_t matrix_dst(pattern);
+  std::fill(matrix.lbegin(), matrix.lend(), 1.0);
+  matrix.barrier();
+
+  GlobBoundSpec_t bound_spec;
+  for (dash::dim_t d = 0; d < NumDimensions; ++d) {
+    bound_spec[d] = dash::halo::BoundaryProp::CYCLIC;
+  }
+
+  Halo_t halo(matrix, bound_spec, stencil_spec);
+  Halo_t halo_push(matrix, dash::halo::HaloUpdateMode::PUSH, bound_spec,
+                   stencil_spec);
+  auto stencil_op = halo.stencil_operator(stencil_spec);
+  auto* lbegin_dst = matrix_dst.lbegin();
+
+  const auto halo_size  = halo.halo_block().halo_size();
+  const auto inner_size = stencil_op.inner.view().size();
+  const auto bnd_size   = matrix.local.size() - inner_size;
+
+  value_t coeff_center  = 0.5;
+  value_t coeff_point   = 0.5 / StencilSpecT::num_stencil_points();
+  auto    kernel        = [&](decltype(stencil_op.boundary.begin())& it) {
+    value_t value = coeff_center * *it;
+    for (std::size_t i = 0; i < StencilSpecT::num_stencil_points(); ++i) {
+      value += coeff_point * it.value_at(i);
+    }
+    return value;
+  };
+  auto    kernel_inner  = [&](decltype(stencil_op.inner.begin())& it) {
+    value_t value = coeff_center * *it;
+    for (std::size_t i = 0; i < StencilSpecT::num_stencil_points(); ++i) {
+      value += coeff_point * it.value_at(i);
+    }
+    return value;
+  };
+
+  auto measure = [&](const std::string & testcase, extent_t elements,
+                     std::function<void()> func) {
+    // warmup
+    func();
+    dash::barrier();
+    auto ts_start = Timer::Now();
+    for (int r = 0; r < params.reps; ++r) {
+      func();
+    }
+    dash::barrier();
+    measurement mes;
+    mes.testcase = testcase;
+    mes.elements = elements;
+    mes.time_us  = Timer::ElapsedSince(ts_start) / params.reps;
+    print_measurement_record(conf, mes, params);
+  };
+
+  measure("update.blocking", halo_size, [&]() {
+    halo.update();
+  });
+  measure("update.async", halo_size + inner_size, [&]() {
+    halo.update_async();
+    stencil_op.inner.update(lbegin_dst, coeff_center, std::plus<value_t>());
+    halo.wait();
+  });
+  measure("update.push", halo_size, [&]() {
+    halo_push.update();
+  });
+
+  for (dash::dim_t level = 1; level <= NumDimensions; ++level) {
+    std::vector<typename Halo_t::region_index_t> regions;
+    extent_t region_elements = 0;
+    for (const auto & region : halo.halo_block().halo_regions()) {
+      if (region.size() > 0 && region.spec().level() == level) {
+        regions.push_back(region.index());
+        region_elements += region.size();
+      }
+    }
+    if (regions.empty()) {
+      continue;
+    }
+    measure("update.level" + std::to_string(level), region_elements, [&]() {
+      for (auto index : regions) {
+        halo.update_async_at(index);
+      }
+      for (auto index : regions) {
+        halo.wait(index);
+      }
+    });
+  }
+
+  halo.update();
+  measure("inner.bulk", inner_size, [&]() {
+    stencil_op.inner.update(lbegin_dst, coeff_center, std::plus<value_t>());
+  });
+  measure("inner.iterator", inner_size, [&]() {
+    auto it_end = stencil_op.inner.end();
+    for (auto it = stencil_op.inner.begin(); it != it_end; ++it) {
+      lbegin_dst[it.lpos()] = kernel_inner(it);
+    }
+  });
+  measure("boundary.iterator", bnd_size, [&]() {
+    stencil_op.boundary.update(lbegin_dst, kernel);
+  });
+}
+
+template<typename PatternT>
+void evaluate_stencils(
+  const std::string      & dist,
+  const std::string      & order,
+  const benchmark_params & params)
+{
+  constexpr auto        NumDimensions = PatternT::ndim();
+  constexpr std::size_t NumBoxPoints  = (NumDimensions == 2) ? 8 : 26;
+
+  if (params.dist != "all" && params.dist != dist) {
+    return;
+  }
+  for (int width = 1; width <= params.width_max; ++width) {
+    evaluate<PatternT>(
+      config { NumDimensions, dist, order, "star", width },
+      star_stencil<NumDimensions>(width), params);
+    evaluate<PatternT>(
+      config { NumDimensions, dist, order, "box", width },
+      box_stencil<NumDimensions, NumBoxPoints>(width), params);
+  }
+}
+
+template<dash::dim_t NumDimensions, dash::MemArrange Arrange>
+void evaluate_patterns(
+  const std::string      & order,
+  const benchmark_params & params)
+{
+  evaluate_stencils<dash::Pattern<NumDimensions, Arrange, index_t>>(
+    "blocked", order, params);
+  evaluate_stencils<dash::TilePattern<NumDimensions, Arrange, index_t>>(
+    "tile", order, params);
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.15.halo");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  for (int round = 0; round < params.rounds; ++round) {
+    if (params.ndim == 0 || params.ndim == 2) {
+      evaluate_patterns<2, dash::ROW_MAJOR>("row", params);
+      evaluate_patterns<2, dash::COL_MAJOR>("col", params);
+    }
+    if (params.ndim == 0 || params.ndim == 3) {
+      evaluate_patterns<3, dash::ROW_MAJOR>("row", params);
+      evaluate_patterns<3, dash::COL_MAJOR>("col", params);
+    }
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"     << ","
+         << std::setw( 9) << "mpi.impl"  << ","
+         << std::setw( 7) << "scaling"   << ","
+         << std::setw( 4) << "ndim"      << ","
+         << std::setw( 7) << "dist"      << ","
+         << std::setw( 5) << "order"     << ","
+         << std::setw( 7) << "stencil"   << ","
+         << std::setw( 5) << "width"     << ","
+         << std::setw(18) << "case"      << ","
+         << std::setw(10) << "elements"  << ","
+         << std::setw(12) << "time.us"   << ","
+         << std::setw(10) << "mb.s"      << ","
+         << std::setw(10) << "mups"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const config           & conf,
+  const measurement      & mes,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+    double mb_s = (mes.elements * sizeof(value_t)) / mes.time_us;
+    double mups = mes.elements / mes.time_us;
+    cout << std::right
+         << std::setw( 5) << dash::size()   << ","
+         << std::setw( 9) << mpi_impl       << ","
+         << std::setw( 7) << params.scaling << ","
+         << std::setw( 4) << conf.ndim      << ","
+         << std::setw( 7) << conf.dist      << ","
+         << std::setw( 5) << conf.order     << ","
+         << std::setw( 7) << conf.stencil   << ","
+         << std::setw( 5) << conf.width     << ","
+         << std::setw(18) << mes.testcase   << ","
+         << std::setw(10) << mes.elements   << ","
+         << std::fixed << setprecision(2)
+         << std::setw(12) << mes.time_us    << ","
+         << std::setw(10) << mb_s           << ","
+         << std::setw(10) << mups
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base = 0;
+  params.scaling   = "weak";
+  params.dist      = "all";
+  params.width_max = 2;
+  params.ndim      = 0;
+  params.reps      = 20;
+  params.rounds    = 1;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base = static_cast<extent_t>(atoi(argv[i+1]));
+    } else if (flag == "-s") {
+      params.scaling   = argv[i+1];
+    } else if (flag == "-p") {
+      params.dist      = argv[i+1];
+    } else if (flag == "-w") {
+      params.width_max = atoi(argv[i+1]);
+    } else if (flag == "-d") {
+      params.ndim      = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.reps      = atoi(argv[i+1]);
+    } else if (flag == "-n") {
+      params.rounds    = atoi(argv[i+1]);
+    }
+  }
+  if (params.size_base == 0) {
+    // local extent in weak scaling, fits 3-D blocks into memory
+    params.size_base = (params.scaling == "weak") ? 64 : 256;
+  }
+  if (params.scaling != "weak" && params.scaling != "strong") {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "Invalid argument: -s <weak|strong>");
+  }
+  if (params.dist != "all" && params.dist != "blocked" &&
+      params.dist != "tile") {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "Invalid argument: -p <all|blocked|tile>");
+  }
+
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-s",  "scaling (weak|strong)", params.scaling);
+  bench_cfg.print_param("-sb", "size base per dim.",    params.size_base);
+  bench_cfg.print_param("-p",  "pattern: blocked|tile", params.dist);
+  bench_cfg.print_param("-w",  "max. halo width",       params.width_max);
+  bench_cfg.print_param("-d",  "dimensions (0: all)",   params.ndim);
+  bench_cfg.print_param("-r",  "repetitions per round", params.reps);
+  bench_cfg.print_param("-n",  "rounds",                params.rounds);
+  bench_cfg.print_section_end();
+}
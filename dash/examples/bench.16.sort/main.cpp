@@ -0,0 +1,241 @@
+/**
+ * Measures the distributed splitter sort dash::sort and the distributed
+ * radix sort dash::radix_sort on uniformly distributed keys.
+ *
+ * The number of local elements is constant (weak scaling), the range of
+ * the keys is given by the number of significant key bits. Every
+ * measurement is printed as one comma-separated record.
+ */
+
+#include <libdash.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <string>
+
+#ifndef DASH_MPI_IMPL_ID
+#define DASH_MPI_IMPL_ID unknown
+#endif
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef dash::default_size_t extent_t;
+
+typedef struct benchmark_params_t {
+  extent_t size_base;
+  int      key_bits;
+  int      reps;
+  int      rounds;
+  bool     verify;
+} benchmark_params;
+
+void print_measurement_header();
+void print_measurement_record(
+  const std::string      & testcase,
+  extent_t                 size,
+  double                   time_us,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+/**
+ * Sorts randomly initialized arrays repeatedly and prints the mean time of
+ * a repetition.
+ */
+template <typename KeyType, typename Distribution>
+void measure(
+  const std::string                               & testcase,
+  const benchmark_params                          & params,
+  Distribution                                      distribution,
+  std::function<void(dash::Array<KeyType> &)>       sort_func)
+{
+  extent_t             size = params.size_base * dash::size();
+  dash::Array<KeyType> array(size);
+  std::mt19937_64      generator(dash::myid());
+
+  double time_us = 0;
+  for (int r = 0; r < params.reps; ++r) {
+    for (auto & key : array.local) {
+      key = distribution(generator);
+    }
+    array.barrier();
+    auto ts_start = Timer::Now();
+    sort_func(array);
+    time_us += Timer::ElapsedSince(ts_start);
+
+    if (params.verify) {
+      // first local element must not be smaller than the last element of
+      // the preceding unit
+      bool sorted = std::is_sorted(array.lbegin(), array.lend());
+      if (dash::myid() > 0 && array.lsize() > 0) {
+        auto gfirst = array.pattern().global(0);
+        sorted = sorted && !(array.local[0] < array[gfirst - 1]);
+      }
+      if (!sorted) {
+        cout << "# unit " << dash::myid() << ": " << testcase
+             << " verification failed" << endl;
+      }
+      array.barrier();
+    }
+  }
+  print_measurement_record(testcase, size, time_us / params.reps, params);
+}
+
+template <typename KeyType, typename Distribution>
+void evaluate(
+  const std::string      & key_name,
+  const benchmark_params & params,
+  Distribution             distribution)
+{
+  measure<KeyType>(key_name + ".sort", params, distribution,
+                   [](dash::Array<KeyType> & a) {
+                     dash::sort(a.begin(), a.end());
+                   });
+  measure<KeyType>(key_name + ".radix", params, distribution,
+                   [](dash::Array<KeyType> & a) {
+                     dash::radix_sort(a.begin(), a.end());
+                   });
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.16.sort");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  uint64_t key_max = (params.key_bits >= 64)
+                     ? std::numeric_limits<uint64_t>::max()
+                     : (uint64_t(1) << params.key_bits) - 1;
+  for (int round = 0; round < params.rounds; ++round) {
+    evaluate<uint64_t>(
+      "uint64", params,
+      std::uniform_int_distribution<uint64_t>(0, key_max));
+    evaluate<int64_t>(
+      "int64", params,
+      std::uniform_int_distribution<int64_t>(
+        -static_cast<int64_t>(key_max / 2),
+        static_cast<int64_t>(key_max / 2)));
+    evaluate<double>(
+      "double", params,
+      std::uniform_real_distribution<double>(-1.0, 1.0));
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"     << ","
+         << std::setw( 9) << "mpi.impl"  << ","
+         << std::setw(13) << "case"      << ","
+         << std::setw(12) << "size"      << ","
+         << std::setw( 5) << "bits"      << ","
+         << std::setw(14) << "time.us"   << ","
+         << std::setw(10) << "mkeys.s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const std::string      & testcase,
+  extent_t                 size,
+  double                   time_us,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+    double mkeys_s = size / time_us;
+    cout << std::right
+         << std::setw( 5) << dash::size()     << ","
+         << std::setw( 9) << mpi_impl         << ","
+         << std::setw(13) << testcase         << ","
+         << std::setw(12) << size             << ","
+         << std::setw( 5) << params.key_bits  << ","
+         << std::fixed << setprecision(2)
+         << std::setw(14) << time_us          << ","
+         << std::setw(10) << mkeys_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base = 1 << 20;
+  params.key_bits  = 64;
+  params.reps      = 5;
+  params.rounds    = 1;
+  params.verify    = false;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base = static_cast<extent_t>(atol(argv[i+1]));
+    } else if (flag == "-k") {
+      params.key_bits  = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.reps      = atoi(argv[i+1]);
+    } else if (flag == "-n") {
+      params.rounds    = atoi(argv[i+1]);
+    } else if (flag == "-verify") {
+      params.verify    = true;
+      --i;
+    }
+  }
+  if (params.key_bits < 1 || params.key_bits > 64) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "Invalid argument: -k <1..64>");
+  }
+
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-sb",     "local elements",        params.size_base);
+  bench_cfg.print_param("-k",      "significant key bits",  params.key_bits);
+  bench_cfg.print_param("-r",      "repetitions per round", params.reps);
+  bench_cfg.print_param("-n",      "rounds",                params.rounds);
+  bench_cfg.print_param("-verify", "verification",          params.verify);
+  bench_cfg.print_section_end();
+}
@@ -13,6 +13,7 @@ using matrix_t     = dash::Matrix<
                        pattern_t>;
 using StencilT     = dash::halo::StencilPoint<2>;
 using StencilSpecT = dash::halo::StencilSpec<StencilT,4>;
+using StepsSpecT   = dash::halo::MultiStepStencilSpec<StencilSpecT>;
 using GlobBoundSpecT   = dash::halo::GlobalBoundarySpec<2>;
 using HaloMatrixWrapperT = dash::halo::HaloMatrixWrapper<matrix_t>;
 
@@ -41,15 +42,51 @@ double calcEnergy(const matrix_t& m, array_t &a) {
     return 0.0;
 }
 
+/*
+ * Performs the iterations with deep halos: the halo regions are updated
+ * every 'steps' iterations, the iterations in between are computed with
+ * temporal blocking on the extended local block.
+ */
+void heat_steps(matrix_t& matrix, matrix_t& matrix_tmp,
+                const GlobBoundSpecT& bound_spec,
+                const StencilSpecT& stencil_spec, int iterations, int steps,
+                double dx, double dy, double dt, double k) {
+  HaloMatrixWrapperT halomat(matrix, bound_spec,
+                             StepsSpecT(stencil_spec, steps));
+  auto stencil_op = halomat.stencil_operator(stencil_spec);
+  using StencilOffsetsT = typename decltype(stencil_op)::StencilOffsets_t;
+
+  auto op = [&](double* center, double* center_dst, long offset,
+                const StencilOffsetsT& offs) {
+    auto core = *center;
+    auto dtheta = (center[offs[0]] + center[offs[1]] - 2 * core) / (dx * dx) +
+                  (center[offs[2]] + center[offs[3]] - 2 * core) / (dy * dy);
+    *center_dst = core + k * dtheta * dt;
+  };
+
+  for (auto d = 0; d < iterations; d += steps) {
+    halomat.update();
+    stencil_op.update_steps_tiled(std::min(steps, iterations - d),
+                                  matrix_tmp.lbegin(), op);
+    // neighbors read the boundaries of the matrix during the halo update
+    matrix.barrier();
+    std::copy(matrix_tmp.lbegin(), matrix_tmp.lend(), matrix.lbegin());
+    matrix.barrier();
+  }
+}
+
 int main(int argc, char *argv[])
 {
 
   if (argc < 3) {
-    cerr << "Not enough arguments ./<prog> matrix_ext iterations" << endl;
+    cerr << "Not enough arguments ./<prog> matrix_ext iterations [steps]"
+         << endl;
     return 1;
   }
   auto matrix_ext = std::atoi(argv[1]);
   auto iterations = std::atoi(argv[2]);
+  // iterations between two halo updates
+  auto steps = (argc > 3) ? std::max(std::atoi(argv[3]), 1) : 1;
 
   dash::init(&argc, &argv);
 
@@ -116,59 +153,64 @@ int main(int argc, char *argv[])
 
   current_halo->matrix().barrier();
 
-  for (auto d = 0; d < iterations; ++d) {
-
-    auto& current_matrix = current_halo->matrix();
-    auto& new_matrix = new_halo->matrix();
-
-    // Update Halos asynchroniously
-    current_halo->update_async();
-
-    // optimized calculation of inner matrix elements
-    auto* current_begin = current_matrix.lbegin();
-    auto* new_begin = new_matrix.lbegin();
-#if 0
-    for (auto i = inner_start; i < inner_end; i += offset) {
-      auto* center = current_begin + i;
-      auto* center_y_plus = center + offset;
-      auto* center_y_minus = center - offset;
-      for (auto j = 0; j < offset - 2;
-           ++j, ++center, ++center_y_plus, ++center_y_minus) {
-        /*auto dtheta =
-            (*(center - 1) + *(center + 1) - 2 * (*center)) / (dx * dx) +
-            (*(center_y_minus) + *(center_y_plus) - 2 * (*center)) / (dy * dy);
-        *(new_begin + i + j) = *center + k * dtheta * dt;*/
-        *(new_begin + i + j) = calc(center, center_y_minus, center_y_plus, center - 1, center + 1);
+  if (steps > 1) {
+    heat_steps(matrix, matrix2, bound_spec, stencil_spec, iterations, steps,
+               dx, dy, dt, k);
+  } else {
+    for (auto d = 0; d < iterations; ++d) {
+
+      auto& current_matrix = current_halo->matrix();
+      auto& new_matrix = new_halo->matrix();
+
+      // Update Halos asynchroniously
+      current_halo->update_async();
+
+      // optimized calculation of inner matrix elements
+      auto* current_begin = current_matrix.lbegin();
+      auto* new_begin = new_matrix.lbegin();
+  #if 0
+      for (auto i = inner_start; i < inner_end; i += offset) {
+        auto* center = current_begin + i;
+        auto* center_y_plus = center + offset;
+        auto* center_y_minus = center - offset;
+        for (auto j = 0; j < offset - 2;
+             ++j, ++center, ++center_y_plus, ++center_y_minus) {
+          /*auto dtheta =
+              (*(center - 1) + *(center + 1) - 2 * (*center)) / (dx * dx) +
+              (*(center_y_minus) + *(center_y_plus) - 2 * (*center)) / (dy * dy);
+          *(new_begin + i + j) = *center + k * dtheta * dt;*/
+          *(new_begin + i + j) = calc(center, center_y_minus, center_y_plus, center - 1, center + 1);
+        }
+      }
+  #endif
+      // slow version
+      auto it_end = current_op->inner.end();
+      for(auto it = current_op->inner.begin(); it != it_end; ++it)
+      {
+        auto core = *it;
+        auto dtheta = (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
+                      (it.value_at(2) + it.value_at(3) - 2 * core) /(dy * dy);
+        new_begin[it.lpos()] = core + k * dtheta * dt;
       }
-    }
-#endif
-    // slow version
-    auto it_end = current_op->inner.end();
-    for(auto it = current_op->inner.begin(); it != it_end; ++it)
-    {
-      auto core = *it;
-      auto dtheta = (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
-                    (it.value_at(2) + it.value_at(3) - 2 * core) /(dy * dy);
-      new_begin[it.lpos()] = core + k * dtheta * dt;
-    }
 
-    // Wait until all Halo updates ready
-    current_halo->wait();
-
-    // Calculation of boundary Halo elements
-    auto it_bend = current_op->boundary.end();
-    for (auto it = current_op->boundary.begin(); it != it_bend; ++it) {
-      auto core = *it;
-      double dtheta =
-          (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
-          (it.value_at(2) + it.value_at(3) - 2 * core) / (dy * dy);
-      new_begin[it.lpos()] = core + k * dtheta * dt;
-    }
+      // Wait until all Halo updates ready
+      current_halo->wait();
+
+      // Calculation of boundary Halo elements
+      auto it_bend = current_op->boundary.end();
+      for (auto it = current_op->boundary.begin(); it != it_bend; ++it) {
+        auto core = *it;
+        double dtheta =
+            (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
+            (it.value_at(2) + it.value_at(3) - 2 * core) / (dy * dy);
+        new_begin[it.lpos()] = core + k * dtheta * dt;
+      }
 
-    // swap current matrix and current halo matrix
-    std::swap(current_halo, new_halo);
-    std::swap(current_op, new_op);
-    current_matrix.barrier();
+      // swap current matrix and current halo matrix
+      std::swap(current_halo, new_halo);
+      std::swap(current_op, new_op);
+      current_matrix.barrier();
+    }
   }
   // final total energy
   double endEnergy = calcEnergy(current_halo->matrix(), energy);
@@ -187,6 +229,7 @@ int main(int argc, char *argv[])
     cout << "DiffEnergy=" << endEnergy - initEnergy << endl;
     cout << "Matrixspec: " << matrix_ext << " x " << matrix_ext << endl;
     cout << "Iterations: " << iterations << endl;
+    cout << "Steps per halo update: " << steps << endl;
     cout.flush();
   }
 
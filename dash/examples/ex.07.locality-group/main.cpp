@@ -27,6 +27,9 @@ int main(int argc, char ** argv)
   char buf[100];
 
   dash::init(&argc, &argv);
+  // Locality information is queried at single units below, create it
+  // collectively first:
+  dart_team_locality_init(DART_TEAM_ALL);
 
 
   std::vector<std::vector<std::string>> groups_subdomain_tags;
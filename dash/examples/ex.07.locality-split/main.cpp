@@ -51,6 +51,9 @@ int main(int argc, char * argv[])
   }
 
   dash::init(&argc, &argv);
+  // Locality information is queried at single units below, create it
+  // collectively first:
+  dart_team_locality_init(DART_TEAM_ALL);
 
   dash::util::BenchmarkParams bench_params("ex.07.locality-split");
   bench_params.print_header();
@@ -121,6 +124,7 @@ int main(int argc, char * argv[])
                       ? dash::Team::All().locality_split(split_scope,
                                                          split_num_groups)
                       : dash::Team::All().split(split_num_groups);
+  dart_team_locality_init(split_team.dart_id());
 
   std::ostringstream t_os;
   t_os << "Unit id " << setw(3) << myid << " -> "
@@ -35,6 +35,9 @@ int main(int argc, char * argv[])
   char buf[100];
 
   dash::init(&argc, &argv);
+  // Locality information is queried at single units below, create it
+  // collectively first:
+  dart_team_locality_init(DART_TEAM_ALL);
 
   dash::util::BenchmarkParams bench_params("ex.07.locality-threads");
   bench_params.print_header();
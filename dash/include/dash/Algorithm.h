@@ -28,5 +28,10 @@
 #include <dash/algorithm/Sort.h>
 
 #include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/Transpose.h>
+#include <dash/algorithm/GatherScatter.h>
+#include <dash/algorithm/RadixSort.h>
+#include <dash/algorithm/NthElement.h>
+#include <dash/algorithm/Partition.h>
 
 #endif // DASH__ALGORITHM_H_
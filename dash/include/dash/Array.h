@@ -11,6 +11,7 @@
 #include <dash/Team.h>
 #include <dash/Types.h>
 
+#include <dash/algorithm/Copy.h>
 #include <dash/allocator/GlobalAllocator.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/memory/MemorySpace.h>
@@ -905,6 +906,10 @@ public:
     , m_lend(other.m_lend)
     , m_myid(other.m_myid)
   {
+    // Global iterators reference the pattern and memory of this instance:
+    m_begin = iterator(&m_globmem, m_pattern);
+    m_end   = m_begin + m_size;
+
     other.m_begin  = iterator{};
     other.m_end    = iterator{};
     other.m_lbegin = nullptr;
@@ -969,8 +974,6 @@ public:
                             m_allocator, m_pattern.local_size()}};
     m_data = std::move(__tmp);
 
-    this->m_begin     = other.m_begin;
-    this->m_end       = other.m_end;
     this->m_lbegin    = other.m_lbegin;
     this->m_lcapacity = other.m_lcapacity;
     this->m_lend      = other.m_lend;
@@ -978,6 +981,9 @@ public:
     this->m_myid      = other.m_myid;
     this->m_size      = other.m_size;
     this->m_team      = other.m_team;
+    // Global iterators reference the pattern and memory of this instance:
+    this->m_begin     = iterator(&m_globmem, m_pattern);
+    this->m_end       = m_begin + m_size;
 
     other.m_begin = iterator{};
     other.m_end   = iterator{};
@@ -1302,6 +1308,28 @@ public:
     return m_pattern;
   }
 
+  /**
+   * Redistributes the array elements to the given pattern, e.g. to change
+   * the block size at run time. The pattern must have the same size.
+   *
+   * Every unit moves its local elements directly to their owners in the
+   * new pattern (see \c dash::copy), elements that stay at their unit are
+   * copied locally. Invalidates all iterators, references and views of the
+   * array.
+   *
+   * Collective operation.
+   */
+  void redistribute(const PatternType & pattern)
+  {
+    DASH_LOG_TRACE("Array.redistribute()");
+    DASH_ASSERT_EQ(pattern.size(), m_pattern.size(),
+                   "Array.redistribute: pattern size does not match");
+    self_t redist(pattern);
+    dash::copy(begin(), end(), redist.begin());
+    *this = std::move(redist);
+    DASH_LOG_TRACE("Array.redistribute >", "lsize:", m_lsize);
+  }
+
   /**
    * Delayed allocation of global memory using a
    * one-dimensional distribution spec.
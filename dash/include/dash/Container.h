@@ -71,6 +71,7 @@
 #include<dash/Array.h>
 #include<dash/Matrix.h>
 #include<dash/Coarray.h>
+#include<dash/SparseMatrix.h>
 
 // Dynamic containers:
 #include<dash/List.h>
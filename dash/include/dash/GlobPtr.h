@@ -396,7 +396,7 @@ public:
   value_type *local()
   {
     void *addr = nullptr;
-    if (dart_gptr_getaddr(m_dart_pointer, &addr) == DART_OK) {
+    if (dart_gptr_getaddr_fast(m_dart_pointer, &addr) == DART_OK) {
       return static_cast<value_type *>(addr);
     }
     return nullptr;
@@ -411,7 +411,7 @@ public:
    */
   const value_type * local() const {
     void *addr = nullptr;
-    if (dart_gptr_getaddr(m_dart_pointer, &addr) == DART_OK) {
+    if (dart_gptr_getaddr_fast(m_dart_pointer, &addr) == DART_OK) {
       return static_cast<const value_type *>(addr);
     }
     return nullptr;
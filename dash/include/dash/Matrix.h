@@ -11,6 +11,8 @@
 
 #include <dash/iterator/GlobIter.h>
 
+#include <dash/algorithm/Copy.h>
+
 #include <dash/matrix/MatrixRefView.h>
 #include <dash/matrix/MatrixRef.h>
 #include <dash/matrix/LocalMatrixRef.h>
@@ -404,6 +406,22 @@ public:
     return allocate(PatternT(arg, args... ));
   }
 
+  /**
+   * Redistributes the matrix elements to the given pattern, e.g. to switch
+   * from a blocked to a tiled distribution at run time. The pattern must
+   * have the same extents.
+   *
+   * Every unit moves its local elements directly to their owners in the
+   * new pattern (see \c dash::copy), elements that stay at their unit are
+   * copied locally. Invalidates all iterators, references and views of the
+   * matrix.
+   *
+   * Collective operation.
+   */
+  void redistribute(
+    const PatternT & pattern
+  );
+
   /**
    * Explicit deallocation of matrix elements, called implicitly in
    * destructor and team deallocation.
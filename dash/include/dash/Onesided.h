@@ -5,6 +5,8 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <cstring>
+
 
 namespace dash {
 
@@ -54,12 +56,21 @@ namespace internal {
    * Blocking write of \c nelem values from \c src to the global memory
    * location referenced by \c gptr.
    *
+   * Values at the calling unit or in its shared memory node are written
+   * directly.
+   *
    * \sa dart_put_blocking
+   * \sa dart_gptr_getaddr_direct
    */
   template<typename T>
   inline
   void
   put_blocking(const dart_gptr_t& gptr, const T *src, size_t nelem) {
+    void * addr = dart_gptr_getaddr_direct(gptr);
+    if (addr != nullptr) {
+      std::memcpy(addr, src, nelem * sizeof(T));
+      return;
+    }
     dash::dart_storage<T> ds(nelem);
     DASH_ASSERT_RETURNS(
       dart_put_blocking(gptr,
@@ -74,12 +85,21 @@ namespace internal {
    * Blocking read of \c nelem values the global memory
    * location referenced by \c gptr into memory referenced by \c src.
    *
+   * Values at the calling unit or in its shared memory node are read
+   * directly.
+   *
    * \sa dart_get_blocking
+   * \sa dart_gptr_getaddr_direct
    */
   template<typename T>
   inline
   void
   get_blocking(const dart_gptr_t& gptr, T *dst, size_t nelem) {
+    const void * addr = dart_gptr_getaddr_direct(gptr);
+    if (addr != nullptr) {
+      std::memcpy(dst, addr, nelem * sizeof(T));
+      return;
+    }
     dash::dart_storage<T> ds(nelem);
     DASH_ASSERT_RETURNS(
       dart_get_blocking(dst,
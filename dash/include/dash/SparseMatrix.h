@@ -0,0 +1,587 @@
+#ifndef DASH__SPARSE_MATRIX_H__INCLUDED
+#define DASH__SPARSE_MATRIX_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+#include <dash/Pattern.h>
+
+#include <dash/pattern/BlockPattern1D.h>
+#include <dash/pattern/CSRPattern.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+/**
+ * Non-zero element of a sparse matrix at global coordinates (row, col).
+ */
+template <
+  typename ElementType,
+  typename IndexType = dash::default_index_t >
+struct SparseMatrixEntry {
+  IndexType   row;
+  IndexType   col;
+  ElementType value;
+};
+
+/**
+ * A two-dimensional sparse matrix with rows distributed to the units of a
+ * team.
+ *
+ * The row distribution is specified by a \c dash::CSRPattern, every unit
+ * stores the non-zero elements of its rows in compressed sparse row (CSR)
+ * format with global column indices.
+ *
+ * Matrices are constructed from (row, col, value) triples specified at
+ * arbitrary units. The triples are moved to the units owning their rows in
+ * a single bulk exchange, duplicate triples are summed up.
+ *
+ * The sparse matrix-vector product <tt>y = A x</tt> (\see multiply) with
+ * vectors of type \c dash::Array determines the elements of \c x required
+ * by the local rows that are owned by other units once per vector and only
+ * fetches these in every product.
+ *
+ * \code
+ *   std::vector<dash::SparseMatrixEntry<double>> entries;
+ *   if (dash::myid() == 0) {
+ *     entries.push_back({ 0, 0, 2.0 });
+ *     entries.push_back({ 1, 3, 1.0 });
+ *   }
+ *   dash::SparseMatrix<double> A(n, n, entries);
+ *   dash::Array<double> x(n);
+ *   dash::Array<double> y(n);
+ *   // ...
+ *   A.multiply(x, y);
+ * \endcode
+ *
+ * \tparam  ElementType  Type of the matrix elements
+ * \tparam  IndexType    Type of row and column indices
+ */
+template <
+  typename ElementType,
+  typename IndexType = dash::default_index_t >
+class SparseMatrix
+{
+private:
+  typedef SparseMatrix<ElementType, IndexType>          self_t;
+
+public:
+  typedef ElementType                                   value_type;
+  typedef IndexType                                     index_type;
+  typedef typename std::make_unsigned<IndexType>::type  size_type;
+  typedef dash::CSRPattern<1, ROW_MAJOR, IndexType>     pattern_type;
+  typedef SparseMatrixEntry<ElementType, IndexType>     entry_type;
+
+private:
+  /*
+   * Elements of the vector x fetched from a single unit with one transfer,
+   * contiguous in the unit's local memory.
+   */
+  struct GhostRun {
+    dart_gptr_t gptr;
+    size_type   offset;
+    size_type   size;
+  };
+
+  /*
+   * Communication plan of the product with a specific vector x.
+   */
+  struct MultiplyPlan {
+    dart_gptr_t              x_gptr = DART_GPTR_NULL;
+    size_type                x_lsize = 0;
+    // Runs of non-local elements of x, fetched behind the local elements
+    // of x in the buffer of x values:
+    std::vector<GhostRun>    runs;
+    // Position of the x value of every local non-zero element in the
+    // buffer of x values:
+    std::vector<size_type>   x_idx;
+    std::vector<value_type>  x_buf;
+  };
+
+public:
+  /**
+   * Constructor, creates a sparse matrix with the given extents and rows
+   * distributed in blocks of equal size like in a \c dash::Array with
+   * \c BLOCKED distribution.
+   *
+   * Collective operation, \c entries are the triples specified by the
+   * calling unit.
+   */
+  SparseMatrix(
+    /// Number of rows
+    size_type                       nrows,
+    /// Number of columns
+    size_type                       ncols,
+    /// Non-zero elements specified by the calling unit
+    const std::vector<entry_type> & entries,
+    /// Team containing the units the rows are distributed to
+    dash::Team                    & team = dash::Team::All())
+  : SparseMatrix(
+      pattern_type(blocked_row_sizes(nrows, team), team),
+      ncols,
+      entries)
+  { }
+
+  /**
+   * Constructor, creates a sparse matrix with rows distributed according
+   * to the given pattern.
+   *
+   * Collective operation, \c entries are the triples specified by the
+   * calling unit.
+   */
+  SparseMatrix(
+    /// Distribution of the rows
+    const pattern_type            & row_pattern,
+    /// Number of columns
+    size_type                       ncols,
+    /// Non-zero elements specified by the calling unit
+    const std::vector<entry_type> & entries)
+  : _pattern(row_pattern),
+    _team(&row_pattern.team()),
+    _ncols(ncols),
+    _row_ptr(row_pattern.local_size() + 1, 0)
+  {
+    DASH_LOG_DEBUG("SparseMatrix()",
+                   "nrows:", _pattern.size(), "ncols:", _ncols,
+                   "entries:", entries.size());
+    for (const auto & entry : entries) {
+      if (entry.row < 0 ||
+          static_cast<size_type>(entry.row) >= _pattern.size() ||
+          entry.col < 0 ||
+          static_cast<size_type>(entry.col) >= _ncols) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "dash::SparseMatrix(): entry (" << entry.row << "," << entry.col <<
+          ") is out of range of matrix extents " <<
+          _pattern.size() << "x" << _ncols);
+      }
+    }
+    auto local_entries = exchange_entries(entries);
+    init_local_rows(local_entries);
+
+    size_type lnnz = _values.size();
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &lnnz, &_nnz, 1, dash::dart_datatype<size_type>::value,
+        DART_OP_SUM, _team->dart_id()),
+      DART_OK);
+    DASH_LOG_DEBUG("SparseMatrix >", "nnz:", _nnz, "local nnz:", lnnz);
+  }
+
+  SparseMatrix(const self_t & other)             = default;
+  SparseMatrix(self_t && other)                  = default;
+  self_t & operator=(const self_t & other)       = default;
+  self_t & operator=(self_t && other)            = default;
+
+  /**
+   * The pattern specifying the distribution of the matrix rows.
+   */
+  constexpr const pattern_type & pattern() const noexcept {
+    return _pattern;
+  }
+
+  /**
+   * The team containing the units the matrix rows are distributed to.
+   */
+  constexpr dash::Team & team() const noexcept {
+    return *_team;
+  }
+
+  constexpr size_type nrows() const noexcept {
+    return _pattern.size();
+  }
+
+  constexpr size_type ncols() const noexcept {
+    return _ncols;
+  }
+
+  /**
+   * Number of non-zero elements in the matrix.
+   */
+  constexpr size_type nnz() const noexcept {
+    return _nnz;
+  }
+
+  /**
+   * Number of rows stored at the calling unit.
+   */
+  constexpr size_type local_nrows() const noexcept {
+    return _pattern.local_size();
+  }
+
+  /**
+   * Number of non-zero elements stored at the calling unit.
+   */
+  size_type local_nnz() const noexcept {
+    return _values.size();
+  }
+
+  /**
+   * Offsets of the local rows in \c local_col_indices and \c local_values,
+   * with <tt>local_nrows() + 1</tt> elements.
+   */
+  const std::vector<size_type> & local_row_ptr() const noexcept {
+    return _row_ptr;
+  }
+
+  /**
+   * Global column indices of the local non-zero elements, ascending within
+   * every row.
+   */
+  const std::vector<index_type> & local_col_indices() const noexcept {
+    return _col_idx;
+  }
+
+  /**
+   * Values of the local non-zero elements.
+   */
+  const std::vector<value_type> & local_values() const noexcept {
+    return _values;
+  }
+
+  /**
+   * Sparse matrix-vector product <tt>y = A x</tt>.
+   *
+   * \c x must have \c ncols() elements, \c y must have \c nrows() elements
+   * distributed like the rows of the matrix, e.g. a \c dash::Array with
+   * \c BLOCKED distribution for matrices constructed with the default row
+   * distribution.
+   *
+   * The elements of \c x required by the local rows are determined in the
+   * first product with a vector and only these are fetched from their
+   * owners in every product, with one transfer per section contiguous in
+   * the owner's local memory. Local rows are computed in parallel if
+   * OpenMP is enabled.
+   *
+   * Collective operation. The elements of \c x must not be modified by any
+   * unit during the operation, \c y is complete at the calling unit and
+   * \c x may be modified once the operation returns.
+   */
+  template <
+    class VectorTypeX,
+    class VectorTypeY >
+  void multiply(
+    /// Vector to multiply with the matrix
+    const VectorTypeX & x,
+    /// Vector to contain the product
+    VectorTypeY       & y)
+  {
+    if (x.size() != _ncols || y.size() != nrows()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::SparseMatrix.multiply(): vector sizes " <<
+        x.size() << "," << y.size() << " do not match matrix extents " <<
+        nrows() << "x" << _ncols);
+    }
+    if (y.pattern().local_size() != local_nrows()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::SparseMatrix.multiply(): local size " <<
+        y.pattern().local_size() << " of result vector does not match " <<
+        "number of local rows " << local_nrows());
+    }
+    auto x_gptr = x.begin().dart_gptr();
+    if (!DART_GPTR_EQUAL(x_gptr, _plan.x_gptr) ||
+        _plan.x_lsize != x.pattern().local_size()) {
+      init_plan(x);
+    }
+
+    // Elements of x must be complete at all units:
+    _team->barrier();
+    std::vector<dart_handle_t> handles;
+    handles.reserve(_plan.runs.size());
+    auto * x_ghosts = _plan.x_buf.data() + _plan.x_lsize;
+    for (const auto & run : _plan.runs) {
+      dart_handle_t handle;
+      dash::internal::get_handle(
+        run.gptr, x_ghosts + run.offset, run.size, &handle);
+      if (handle != DART_HANDLE_NULL) {
+        handles.push_back(handle);
+      }
+    }
+    std::copy(x.lbegin(), x.lbegin() + _plan.x_lsize, _plan.x_buf.data());
+    if (!handles.empty()) {
+      dart_waitall(handles.data(), handles.size());
+    }
+    // Elements of x may be modified by their owners once all units
+    // fetched them:
+    _team->barrier();
+
+    const value_type * x_buf = _plan.x_buf.data();
+    const size_type  * x_idx = _plan.x_idx.data();
+    const value_type * vals  = _values.data();
+    const size_type  * rptr  = _row_ptr.data();
+    value_type       * y_out = y.lbegin();
+    index_type         nlrows = local_nrows();
+#ifdef DASH_ENABLE_OPENMP
+    dash::util::UnitLocality uloc;
+    auto n_threads = uloc.num_domain_threads();
+    DASH_LOG_DEBUG("SparseMatrix.multiply", "thread capacity:", n_threads);
+    #pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+    for (index_type lrow = 0; lrow < nlrows; ++lrow) {
+      value_type sum = value_type();
+      for (size_type k = rptr[lrow]; k < rptr[lrow + 1]; ++k) {
+        sum += vals[k] * x_buf[x_idx[k]];
+      }
+      y_out[lrow] = sum;
+    }
+  }
+
+private:
+  /*
+   * Number of rows of every unit in a blocked distribution of the given
+   * number of rows.
+   */
+  static std::vector<size_type> blocked_row_sizes(
+    size_type    nrows,
+    dash::Team & team)
+  {
+    dash::Pattern<1, ROW_MAJOR, IndexType> blocked(
+      nrows, dash::BLOCKED, team);
+    std::vector<size_type> sizes(team.size());
+    for (size_type u = 0; u < sizes.size(); ++u) {
+      sizes[u] = blocked.local_size(team_unit_t(u));
+    }
+    return sizes;
+  }
+
+  /*
+   * Moves the given entries to the units owning their rows. Every unit
+   * groups its entries by owner in a buffer registered in global memory
+   * and publishes the section for every unit, which then fetches its
+   * entries from all units.
+   */
+  std::vector<entry_type> exchange_entries(
+    const std::vector<entry_type> & entries)
+  {
+    auto nunits = _team->size();
+    auto myid   = _team->myid();
+
+    std::vector<size_t> send_count(nunits, 0);
+    std::vector<team_unit_t> owners;
+    owners.reserve(entries.size());
+    for (const auto & entry : entries) {
+      owners.push_back(_pattern.unit_at(entry.row));
+      ++send_count[owners.back()];
+    }
+    // Count and offset of the section of every unit in the send buffer:
+    std::vector<size_t> send_info(2 * nunits);
+    size_t offset = 0;
+    for (size_t u = 0; u < nunits; ++u) {
+      send_info[2 * u]     = send_count[u];
+      send_info[2 * u + 1] = offset;
+      offset += send_count[u];
+    }
+    std::vector<entry_type> send_buf(entries.size());
+    {
+      std::vector<size_t> pos(nunits);
+      for (size_t u = 0; u < nunits; ++u) {
+        pos[u] = send_info[2 * u + 1];
+      }
+      for (size_t e = 0; e < entries.size(); ++e) {
+        send_buf[pos[owners[e]]++] = entries[e];
+      }
+    }
+
+    dart_gptr_t send_gptr;
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister(
+        _team->dart_id(), send_buf.size() * sizeof(entry_type),
+        DART_TYPE_BYTE, send_buf.data(), &send_gptr),
+      DART_OK);
+
+    std::vector<size_t> recv_info(2 * nunits);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        send_info.data(), recv_info.data(), 2,
+        dash::dart_datatype<size_t>::value, _team->dart_id()),
+      DART_OK);
+
+    size_t recv_size = 0;
+    for (size_t u = 0; u < nunits; ++u) {
+      recv_size += recv_info[2 * u];
+    }
+    DASH_LOG_TRACE("SparseMatrix.exchange_entries",
+                   "send:", entries.size(), "receive:", recv_size);
+    std::vector<entry_type>    recv_buf(recv_size);
+    std::vector<dart_handle_t> handles;
+    auto recv_pos = recv_buf.data();
+    for (size_t u = 0; u < nunits; ++u) {
+      auto count = recv_info[2 * u];
+      auto first = recv_info[2 * u + 1];
+      if (count == 0) {
+        continue;
+      }
+      if (u == static_cast<size_t>(myid)) {
+        std::copy(send_buf.begin() + first,
+                  send_buf.begin() + first + count,
+                  recv_pos);
+      } else {
+        auto gptr = send_gptr;
+        dart_gptr_setunit(&gptr, team_unit_t(u));
+        dart_gptr_incaddr(&gptr, first * sizeof(entry_type));
+        dart_handle_t handle;
+        dash::internal::get_handle(gptr, recv_pos, count, &handle);
+        if (handle != DART_HANDLE_NULL) {
+          handles.push_back(handle);
+        }
+      }
+      recv_pos += count;
+    }
+    if (!handles.empty()) {
+      dart_waitall(handles.data(), handles.size());
+    }
+    // Send buffers must remain registered until all units fetched their
+    // entries:
+    _team->barrier();
+    DASH_ASSERT_RETURNS(
+      dart_team_memderegister(send_gptr),
+      DART_OK);
+    return recv_buf;
+  }
+
+  /*
+   * Creates the CSR representation of the local rows from their entries,
+   * summing up duplicate entries.
+   */
+  void init_local_rows(std::vector<entry_type> & entries)
+  {
+    auto nlrows    = local_nrows();
+    auto row_begin = nlrows > 0 ? _pattern.global(0) : 0;
+    for (const auto & entry : entries) {
+      ++_row_ptr[entry.row - row_begin + 1];
+    }
+    std::partial_sum(_row_ptr.begin(), _row_ptr.end(), _row_ptr.begin());
+    std::vector<std::pair<index_type, value_type>> row_entries(
+      entries.size());
+    {
+      std::vector<size_type> pos(_row_ptr.begin(), _row_ptr.end() - 1);
+      for (const auto & entry : entries) {
+        row_entries[pos[entry.row - row_begin]++] =
+          std::make_pair(entry.col, entry.value);
+      }
+    }
+    _col_idx.reserve(row_entries.size());
+    _values.reserve(row_entries.size());
+    size_type nnz = 0;
+    for (size_type lrow = 0; lrow < nlrows; ++lrow) {
+      auto first = row_entries.begin() + _row_ptr[lrow];
+      auto last  = row_entries.begin() + _row_ptr[lrow + 1];
+      std::sort(first, last,
+                [](const std::pair<index_type, value_type> & a,
+                   const std::pair<index_type, value_type> & b) {
+                  return (a.first) < b.first;
+                });
+      _row_ptr[lrow] = nnz;
+      for (auto it = first; it != last; ++it) {
+        if (nnz > _row_ptr[lrow] && _col_idx.back() == it->first) {
+          _values.back() += it->second;
+          continue;
+        }
+        _col_idx.push_back(it->first);
+        _values.push_back(it->second);
+        ++nnz;
+      }
+    }
+    _row_ptr[nlrows] = nnz;
+  }
+
+  /*
+   * Determines the elements of x referenced by the local non-zero elements
+   * and the transfers fetching those owned by other units.
+   */
+  template <class VectorTypeX>
+  void init_plan(const VectorTypeX & x)
+  {
+    typedef typename VectorTypeX::index_type x_index_t;
+
+    const auto & x_pattern = x.pattern();
+    auto         myid      = _team->myid();
+
+    _plan        = MultiplyPlan();
+    _plan.x_gptr  = x.begin().dart_gptr();
+    _plan.x_lsize = x_pattern.local_size();
+    _plan.x_idx.resize(_col_idx.size());
+
+    // Non-local columns with their owner and local index at the owner:
+    struct Ghost {
+      index_type  col;
+      team_unit_t unit;
+      x_index_t   lindex;
+    };
+    std::vector<Ghost> ghosts;
+    std::unordered_map<index_type, size_type> ghost_pos;
+    for (size_type k = 0; k < _col_idx.size(); ++k) {
+      auto col = _col_idx[k];
+      auto lidx = x_pattern.local_index(
+                    std::array<x_index_t, 1> {{
+                      static_cast<x_index_t>(col) }});
+      if (lidx.unit == myid) {
+        _plan.x_idx[k] = lidx.index;
+      } else if (ghost_pos.emplace(col, 0).second) {
+        ghosts.push_back(Ghost { col, lidx.unit, lidx.index });
+      }
+    }
+    std::sort(ghosts.begin(), ghosts.end(),
+              [](const Ghost & a, const Ghost & b) {
+                return a.unit < b.unit ||
+                       (a.unit == b.unit && a.lindex < b.lindex);
+              });
+    for (size_type g = 0; g < ghosts.size(); ++g) {
+      ghost_pos[ghosts[g].col] = g;
+      const auto & ghost = ghosts[g];
+      if (!_plan.runs.empty() && ghost.unit == ghosts[g-1].unit &&
+          ghost.lindex == ghosts[g-1].lindex + 1) {
+        ++_plan.runs.back().size;
+      } else {
+        _plan.runs.push_back(
+          GhostRun { (x.begin() + ghost.col).dart_gptr(), g, 1 });
+      }
+    }
+    for (size_type k = 0; k < _col_idx.size(); ++k) {
+      auto it = ghost_pos.find(_col_idx[k]);
+      if (it != ghost_pos.end()) {
+        _plan.x_idx[k] = _plan.x_lsize + it->second;
+      }
+    }
+    _plan.x_buf.resize(_plan.x_lsize + ghosts.size());
+    DASH_LOG_DEBUG("SparseMatrix.init_plan",
+                   "ghost elements:", ghosts.size(),
+                   "transfers:", _plan.runs.size());
+  }
+
+private:
+  pattern_type             _pattern;
+  dash::Team             * _team = nullptr;
+  size_type                _ncols  = 0;
+  size_type                _nnz    = 0;
+  std::vector<size_type>   _row_ptr;
+  std::vector<index_type>  _col_idx;
+  std::vector<value_type>  _values;
+  MultiplyPlan             _plan;
+
+}; // class SparseMatrix
+
+} // namespace dash
+
+#endif // DASH__SPARSE_MATRIX_H__INCLUDED
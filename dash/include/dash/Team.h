@@ -567,9 +567,7 @@ private:
   {
     DASH_LOG_DEBUG("Team.register_team",
                    "team id:", team->_dartid);
-    DASH_ASSERT_RETURNS(
-      dart_team_locality_init(team->_dartid),
-      DART_OK);
+    // Locality information of the team is created on first use:
     dash::Team::_teams.insert(
       std::make_pair(team->_dartid, team));
   }
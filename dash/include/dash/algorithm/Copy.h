@@ -7,6 +7,7 @@
 #include <dash/algorithm/LocalRange.h>
 
 #include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_locality.h>
 
 #include <algorithm>
 #include <future>
@@ -274,17 +275,17 @@ dash::Future<ValueType *> copy_async(
   GlobInputIt   in_last,
   ValueType   * out_first)
 {
-  const auto & team = in_first.team();
-
   DASH_LOG_TRACE("dash::copy_async()", "async, global to local");
   if (in_first == in_last) {
     DASH_LOG_TRACE("dash::copy_async", "input range empty");
     return dash::Future<ValueType *>(out_first);
   }
 
-  dash::util::UnitLocality uloc(team, team.myid());
+  // Hardware locality of the calling unit, does not communicate:
+  const dart_hwinfo_t * hwinfo;
+  DASH_ASSERT_RETURNS(dart_unit_hwinfo(&hwinfo), DART_OK);
   // Size of L2 data cache line:
-  int  l2_line_size = uloc.hwinfo().cache_line_sizes[1];
+  int  l2_line_size = hwinfo->cache_line_sizes[1];
   bool use_memcpy   = ((in_last - in_first) * sizeof(ValueType))
                       <= l2_line_size;
 
@@ -489,8 +490,8 @@ dash::Future<ValueType *> copy_async(
     [=](ValueType ** out) mutable {
       int32_t flag;
       DASH_ASSERT_RETURNS(
-        DART_OK,
-        dart_testall_local(handles->data(), handles->size(), &flag));
+        dart_testall_local(handles->data(), handles->size(), &flag),
+        DART_OK);
       if (flag) {
         handles->clear();
         *out = out_last;
@@ -525,10 +526,11 @@ ValueType * copy(
   GlobInputIt   in_last,
   ValueType   * out_first)
 {
-  const auto & team = in_first.team();
-  dash::util::UnitLocality uloc(team, team.myid());
+  // Hardware locality of the calling unit, does not communicate:
+  const dart_hwinfo_t * hwinfo;
+  DASH_ASSERT_RETURNS(dart_unit_hwinfo(&hwinfo), DART_OK);
   // Size of L2 data cache line:
-  int  l2_line_size = uloc.hwinfo().cache_line_sizes[1];
+  int  l2_line_size = hwinfo->cache_line_sizes[1];
   bool use_memcpy   = ((in_last - in_first) * sizeof(ValueType))
                       <= l2_line_size;
 
@@ -765,8 +767,8 @@ dash::Future<GlobOutputIt> copy_async(
     [=](GlobOutputIt *out) mutable {
       int32_t flag;
       DASH_ASSERT_RETURNS(
-        DART_OK,
-        dart_testall(handles->data(), handles->size(), &flag));
+        dart_testall(handles->data(), handles->size(), &flag),
+        DART_OK);
       if (flag) {
         handles->clear();
         *out = out_last;
@@ -937,25 +939,381 @@ copy_async(
 }
 #endif
 
+// =========================================================================
+// Global to Global
+// =========================================================================
+
+namespace internal {
+
+/**
+ * Number of elements starting at global index \c g_idx that are contiguous
+ * in the global index space and in the local memory of their owner, i.e.
+ * the remainder of the row of the block containing \c g_idx in the fastest
+ * dimension of the pattern's memory order.
+ * The owner and local index of \c g_idx are returned in \c l_pos.
+ */
+template <class PatternType>
+typename PatternType::index_type
+contiguous_block_run(
+  const PatternType                        & pattern,
+  typename PatternType::index_type           g_idx,
+  typename PatternType::local_index_t      & l_pos)
+{
+  typedef typename PatternType::index_type index_t;
+
+  const dim_t fast_dim = (pattern.memory_order() == ROW_MAJOR)
+                         ? pattern.ndim() - 1
+                         : 0;
+  auto    coords    = pattern.coords(g_idx);
+  auto    block     = pattern.block(pattern.block_at(coords));
+  // Extents of underfilled blocks are not reduced by every pattern type:
+  index_t block_end = std::min<index_t>(
+                        block.offset(fast_dim) + block.extent(fast_dim),
+                        pattern.extent(fast_dim));
+  l_pos = pattern.local_index(coords);
+  return block_end - coords[fast_dim];
+}
+
+/**
+ * Calls \c visit with the offset in the input range, the local index and
+ * the number of elements of every run of elements of the input range in
+ * the calling unit's local memory, in order of local indices.
+ *
+ * Runs are the intersections of the rows of the calling unit's blocks with
+ * the input range, contiguous in the global index space and in local
+ * memory.
+ */
+template <
+  class GlobInputIt,
+  class Visitor >
+typename std::enable_if< !GlobInputIt::has_view::value >::type
+for_each_local_run(
+  GlobInputIt                            in_first,
+  typename GlobInputIt::difference_type  num_elem,
+  Visitor                                visit)
+{
+  typedef typename GlobInputIt::pattern_type::index_type index_t;
+
+  const auto & pattern  = in_first.pattern();
+  auto         in_last  = in_first + num_elem;
+  index_t      in_begin = in_first.pos();
+  index_t      in_end   = in_last.pos();
+  // Local indices are ordered like global indices in one-dimensional
+  // patterns, so the local index range of the input range can be resolved
+  // directly:
+  index_t l_begin = 0;
+  index_t l_end   = pattern.local_size();
+  if (pattern.ndim() == 1) {
+    auto l_range = dash::local_index_range(in_first, in_last);
+    l_begin      = l_range.begin;
+    l_end        = l_range.end;
+  }
+  typename GlobInputIt::pattern_type::local_index_t l_pos;
+  for (index_t l_idx = l_begin; l_idx < l_end; ) {
+    index_t g_idx = pattern.global(l_idx);
+    index_t nrun  = std::min<index_t>(
+                      contiguous_block_run(pattern, g_idx, l_pos),
+                      l_end - l_idx);
+    // Intersection of the run with the input range:
+    index_t g_first = std::max<index_t>(g_idx, in_begin);
+    index_t g_last  = std::min<index_t>(g_idx + nrun, in_end);
+    if (g_first < g_last) {
+      visit(g_first - in_begin, l_idx + (g_first - g_idx),
+            g_last - g_first);
+    }
+    l_idx += nrun;
+  }
+}
+
+/**
+ * Calls \c visit with the offset in the input range, the local index and
+ * a count of 1 for every element of the input view in the calling unit's
+ * local memory.
+ *
+ * Views do not map to a global index range, so every element of the view
+ * is resolved.
+ */
+template <
+  class GlobInputIt,
+  class Visitor >
+typename std::enable_if< GlobInputIt::has_view::value >::type
+for_each_local_run(
+  GlobInputIt                            in_first,
+  typename GlobInputIt::difference_type  num_elem,
+  Visitor                                visit)
+{
+  auto myid = in_first.pattern().team().myid();
+  for (decltype(num_elem) offset = 0; offset < num_elem; ++offset) {
+    auto l_pos = (in_first + offset).lpos();
+    if (l_pos.unit == myid) {
+      visit(offset, l_pos.index, 1);
+    }
+  }
+}
+
+/**
+ * Number of elements starting at the position of \c out that are
+ * contiguous in the local memory of their owner, see
+ * \c contiguous_block_run.
+ */
+template <class GlobOutputIt>
+typename std::enable_if<
+  !GlobOutputIt::has_view::value,
+  typename GlobOutputIt::pattern_type::index_type >::type
+contiguous_out_run(
+  GlobOutputIt                                       out,
+  typename GlobOutputIt::pattern_type::local_index_t & l_pos)
+{
+  return contiguous_block_run(out.pattern(), out.pos(), l_pos);
+}
+
+/**
+ * Views do not map to a global index range, elements of an output view
+ * are resolved one by one.
+ */
+template <class GlobOutputIt>
+typename std::enable_if<
+  GlobOutputIt::has_view::value,
+  typename GlobOutputIt::pattern_type::index_type >::type
+contiguous_out_run(
+  GlobOutputIt                                       out,
+  typename GlobOutputIt::pattern_type::local_index_t & l_pos)
+{
+  l_pos = out.lpos();
+  return 1;
+}
+
+/**
+ * Implementation of \c dash::copy (global to global) for the elements of
+ * the input range in the calling unit's local memory.
+ *
+ * The local blocks of the input range are intersected with the blocks of
+ * the output range. Every intersection is contiguous in the local memory
+ * of both the calling and the destination unit and moved in a single
+ * transfer, intersections with local destination are copied without
+ * communication. Adjacent intersections are merged if they remain
+ * contiguous.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+GlobOutputIt copy_global_impl(
+  GlobInputIt                  in_first,
+  GlobInputIt                  in_last,
+  GlobOutputIt                 out_first,
+  std::vector<dart_handle_t> & handles)
+{
+  typedef typename GlobInputIt::pattern_type::index_type  in_index_t;
+  typedef typename GlobOutputIt::pattern_type::index_type out_index_t;
+  typedef typename GlobInputIt::difference_type           offset_t;
+
+  offset_t num_elem_total = dash::distance(in_first, in_last);
+  auto     out_last       = out_first + num_elem_total;
+  if (num_elem_total <= 0) {
+    DASH_LOG_TRACE("dash::copy_global_impl", "input range empty");
+    return out_last;
+  }
+  DASH_LOG_TRACE("dash::copy_global_impl",
+                 "in_first:",  in_first.pos(),
+                 "in_last:",   in_last.pos(),
+                 "out_first:", out_first.pos());
+  auto out_myid = out_first.pattern().team().myid();
+
+  // Current run of local elements:
+  offset_t    run_offset = 0;
+  offset_t    run_size   = 0;
+  in_index_t  run_l_in   = 0;
+  team_unit_t run_unit   = UNDEFINED_TEAM_UNIT_ID;
+  out_index_t run_l_out  = 0;
+
+  auto copy_run = [&]() {
+    if (run_size == 0) {
+      return;
+    }
+    auto src  = (in_first + run_offset).local();
+    auto dest = out_first + run_offset;
+    DASH_LOG_TRACE("dash::copy_global_impl", "copy run",
+                   "offset:", run_offset,
+                   "size:",   run_size,
+                   "unit:",   run_unit,
+                   "l_idx:",  run_l_out);
+    if (run_unit == out_myid) {
+      std::copy(src, src + run_size, dest.local());
+    } else {
+      dart_handle_t handle;
+      dash::internal::put_handle(dest.dart_gptr(), src, run_size, &handle);
+      if (handle != DART_HANDLE_NULL) {
+        handles.push_back(handle);
+      }
+    }
+  };
+
+  typename GlobOutputIt::pattern_type::local_index_t l_pos_out;
+  for_each_local_run(
+    in_first, num_elem_total,
+    [&](offset_t offset, in_index_t l_idx, offset_t count) {
+      // Split the run at the block borders of the output range:
+      while (count > 0) {
+        offset_t nout = std::min<offset_t>(
+                          count,
+                          contiguous_out_run(out_first + offset, l_pos_out));
+        if (run_size > 0 &&
+            offset          == run_offset + run_size &&
+            l_idx           == run_l_in   + run_size &&
+            l_pos_out.unit  == run_unit &&
+            l_pos_out.index == run_l_out  + run_size) {
+          run_size += nout;
+        } else {
+          copy_run();
+          run_offset = offset;
+          run_size   = nout;
+          run_l_in   = l_idx;
+          run_unit   = l_pos_out.unit;
+          run_l_out  = l_pos_out.index;
+        }
+        offset += nout;
+        l_idx  += nout;
+        count  -= nout;
+      }
+    });
+  copy_run();
+
+  DASH_LOG_TRACE("dash::copy_global_impl >",
+                 "num_handles:", handles.size());
+  return out_last;
+}
+
+} // namespace internal
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-global copy
+ * operation.
+ *
+ * Every unit moves the elements of the input range in its local memory
+ * directly to their owners in the output range, so the operation is
+ * collective. Completing the returned future only completes the transfers
+ * of the calling unit; the output range is complete once all units
+ * completed their futures, e.g. after a subsequent barrier.
+ *
+ * Input and output range must not overlap.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType = void,
+  class    GlobInputIt,
+  class    GlobOutputIt >
+typename std::enable_if<
+  dash::detail::is_global_iterator<GlobInputIt>::value &&
+  dash::detail::is_global_iterator<GlobOutputIt>::value,
+  dash::Future<GlobOutputIt>
+>::type
+copy_async(
+  GlobInputIt  in_first,
+  GlobInputIt  in_last,
+  GlobOutputIt out_first)
+{
+  DASH_LOG_TRACE("dash::copy_async()", "global to global");
+  auto handles  = std::make_shared<std::vector<dart_handle_t>>();
+  auto out_last = dash::internal::copy_global_impl(in_first,
+                                                   in_last,
+                                                   out_first,
+                                                   *handles);
+
+  if (handles->empty()) {
+    return dash::Future<GlobOutputIt>(out_last);
+  }
+  dash::Future<GlobOutputIt> fut_result(
+    // get
+    [=]() mutable {
+      DASH_LOG_TRACE("dash::copy_async [Future]()",
+                    "  wait for", handles->size(), "async put request");
+      if (!handles->empty()) {
+        if (dart_waitall(handles->data(), handles->size())
+            != DART_OK) {
+          DASH_LOG_ERROR("dash::copy_async [Future]",
+                        "  dart_waitall failed");
+          DASH_THROW(
+            dash::exception::RuntimeError,
+            "dash::copy_async [Future]: dart_waitall failed");
+        }
+      }
+      handles->clear();
+      return out_last;
+    },
+    // test
+    [=](GlobOutputIt *out) mutable {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_testall(handles->data(), handles->size(), &flag),
+        DART_OK);
+      if (flag) {
+        handles->clear();
+        *out = out_last;
+      }
+      return (flag != 0);
+    },
+    // destroy
+    [=]() mutable {
+      for (auto& handle : *handles) {
+        DASH_ASSERT_RETURNS(
+          DART_OK,
+          dart_handle_free(&handle));
+      }
+    }
+  );
+  return fut_result;
+}
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Every unit moves the elements of the input range in its local memory
+ * directly to their owners in the output range, which allows to change
+ * the distribution of data at run time:
+ *
+ * \code
+ *     dash::Array<double> a(n, dash::BLOCKED);
+ *     dash::Array<double> b(n, dash::BLOCKCYCLIC(16));
+ *     // ...
+ *     dash::copy(a.begin(), a.end(), b.begin());
+ * \endcode
+ *
+ * The operation is collective on the team of the output range and returns
+ * once the output range is complete at all units. Input and output range
+ * must not overlap.
+ *
  * \ingroup  DashAlgorithms
  */
-template <typename ValueType, class GlobInputIt, class GlobOutputIt>
-GlobOutputIt copy(
-    GlobInputIt /*in_first*/,
-    GlobInputIt /*in_last*/,
-    GlobOutputIt /*out_first*/)
+template <
+  typename ValueType = void,
+  class    GlobInputIt,
+  class    GlobOutputIt >
+typename std::enable_if<
+  dash::detail::is_global_iterator<GlobInputIt>::value &&
+  dash::detail::is_global_iterator<GlobOutputIt>::value,
+  GlobOutputIt
+>::type
+copy(
+  GlobInputIt  in_first,
+  GlobInputIt  in_last,
+  GlobOutputIt out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
+  std::vector<dart_handle_t> handles;
+  auto out_last = dash::internal::copy_global_impl(in_first,
+                                                   in_last,
+                                                   out_first,
+                                                   handles);
+  if (!handles.empty()) {
+    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
+                  "num_handles: ", handles.size());
+    dart_waitall(handles.data(), handles.size());
+  }
+  out_first.pattern().team().barrier();
 
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
+  return out_last;
 }
 
 #endif // DOXYGEN
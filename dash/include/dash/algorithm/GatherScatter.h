@@ -0,0 +1,452 @@
+#ifndef DASH__ALGORITHM__GATHER_SCATTER_H__INCLUDED
+#define DASH__ALGORITHM__GATHER_SCATTER_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Onesided.h>
+
+#include <dash/algorithm/Operation.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <map>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Elements of a container at random global indices, grouped by the units
+ * owning them.
+ */
+template <typename IndexType>
+struct owner_batches {
+  /// Local indices of the elements at their owners, grouped by owner
+  std::vector<IndexType> lindex;
+  /// Position of every element of \c lindex in the sequence of indices
+  std::vector<size_t>    pos;
+  /// Number of elements and offset in \c lindex of the batch of every
+  /// owner, two values per unit
+  std::vector<size_t>    sections;
+};
+
+/**
+ * Groups the global indices in the range [first, last) by the units owning
+ * their elements in the given pattern.
+ */
+template <
+  class PatternType,
+  class IndexIter >
+owner_batches<typename PatternType::index_type>
+group_by_owner(
+  const PatternType & pattern,
+  IndexIter           first,
+  IndexIter           last)
+{
+  typedef typename PatternType::index_type index_t;
+
+  owner_batches<index_t>   batches;
+  size_t                   nunits = pattern.team().size();
+  size_t                   nidx   = std::distance(first, last);
+  std::vector<team_unit_t> owners;
+  std::vector<index_t>     lindex;
+  owners.reserve(nidx);
+  lindex.reserve(nidx);
+  batches.sections.assign(2 * nunits, 0);
+  for (auto it = first; it != last; ++it) {
+    auto lidx = pattern.local_index(
+                  std::array<index_t, 1> {{ static_cast<index_t>(*it) }});
+    owners.push_back(lidx.unit);
+    lindex.push_back(lidx.index);
+    ++batches.sections[2 * lidx.unit];
+  }
+  std::vector<size_t> fill(nunits);
+  size_t offset = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    batches.sections[2 * u + 1] = offset;
+    fill[u]                     = offset;
+    offset += batches.sections[2 * u];
+  }
+  batches.lindex.resize(nidx);
+  batches.pos.resize(nidx);
+  for (size_t i = 0; i < nidx; ++i) {
+    auto p = fill[owners[i]]++;
+    batches.lindex[p] = lindex[i];
+    batches.pos[p]    = i;
+  }
+  return batches;
+}
+
+/**
+ * Batch buffer of the team holding at least \c size elements.
+ *
+ * The buffer is kept between exchanges so its registration is served from
+ * the registration cache of the team, see \c register_batch. Buffers used
+ * at the same time must differ in \c Slot. A buffer only grows, the cached
+ * registrations of the team are flushed first if it grows at any unit, as
+ * released memory must not remain attached.
+ *
+ * Collective operation.
+ */
+template <typename ValueType, int Slot>
+std::vector<ValueType> & batch_buffer(
+  dash::Team & team,
+  size_t       size)
+{
+  static std::map<dart_team_t, std::vector<ValueType>> buffers;
+  auto & buf  = buffers[team.dart_id()];
+  int    grow = (buf.size() < size);
+  int    any_grow;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&grow, &any_grow, 1,
+      DART_TYPE_INT, DART_OP_MAX, team.dart_id()),
+    DART_OK);
+  if (any_grow) {
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister_flush(team.dart_id()),
+      DART_OK);
+    if (grow) {
+      size_t capacity = std::max(size, 2 * buf.size());
+      buf.clear();
+      buf.resize(capacity);
+    }
+  }
+  return buf;
+}
+
+/**
+ * Registers the given batch buffer obtained from \c batch_buffer in the
+ * global memory of the team. The registration is persistent, so
+ * registering the same buffer again does not attach it again.
+ *
+ * Collective operation.
+ */
+template <typename ValueType>
+dart_gptr_t register_batch(
+  dash::Team             & team,
+  std::vector<ValueType> & buf)
+{
+  dart_gptr_t gptr;
+  dash::dart_storage<ValueType> ds(buf.size());
+  DASH_ASSERT_RETURNS(
+    dart_team_memregister_persistent(
+      team.dart_id(), ds.nelem, ds.dtype, buf.data(), &gptr),
+    DART_OK);
+  return gptr;
+}
+
+/**
+ * Global pointer to the element at the given offset in the registered
+ * batch buffer of a unit.
+ */
+template <typename ValueType>
+dart_gptr_t batch_gptr(
+  dart_gptr_t gptr,
+  team_unit_t unit,
+  size_t      offset)
+{
+  dart_gptr_setunit(&gptr, unit);
+  dart_gptr_incaddr(&gptr, offset * sizeof(ValueType));
+  return gptr;
+}
+
+/**
+ * Exchanges the sections of the owner batches of all units, so every unit
+ * knows number and offset of the elements requested from it by every unit.
+ *
+ * Collective operation.
+ */
+inline std::vector<size_t> exchange_batch_sections(
+  dash::Team                & team,
+  const std::vector<size_t> & sections)
+{
+  std::vector<size_t> recv_sections(sections.size());
+  DASH_ASSERT_RETURNS(
+    dart_alltoall(
+      sections.data(), recv_sections.data(), 2,
+      dash::dart_datatype<size_t>::value, team.dart_id()),
+    DART_OK);
+  return recv_sections;
+}
+
+/**
+ * Fetches the sections of the registered batch buffers of all other units
+ * requested from the calling unit into the contiguous buffer \c buf, with
+ * one transfer per unit.
+ */
+template <typename ValueType>
+void fetch_batches(
+  dash::Team                 & team,
+  dart_gptr_t                  gptr,
+  const std::vector<size_t>  & recv_sections,
+  std::vector<ValueType>     & buf,
+  std::vector<dart_handle_t> & handles)
+{
+  size_t nunits    = team.size();
+  size_t myid      = team.myid();
+  size_t recv_size = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    if (u != myid) {
+      recv_size += recv_sections[2 * u];
+    }
+  }
+  buf.resize(recv_size);
+  auto recv_pos = buf.data();
+  for (size_t u = 0; u < nunits; ++u) {
+    auto count = recv_sections[2 * u];
+    if (count == 0 || u == myid) {
+      continue;
+    }
+    dart_handle_t handle;
+    dash::internal::get_handle(
+      batch_gptr<ValueType>(gptr, team_unit_t(u), recv_sections[2 * u + 1]),
+      recv_pos, count, &handle);
+    if (handle != DART_HANDLE_NULL) {
+      handles.push_back(handle);
+    }
+    recv_pos += count;
+  }
+}
+
+} // namespace internal
+
+/**
+ * Reads the elements of \c array at the global indices in the range
+ * [idx_first, idx_last) into the range beginning at \c out.
+ *
+ * Indices are grouped by the units owning their elements. Every owner
+ * fetches the indices requested by a unit in a single transfer and writes
+ * the requested values back in a single transfer, instead of one remote
+ * access per element.
+ *
+ * Collective operation, every unit specifies its own, possibly empty,
+ * range of indices.
+ *
+ * \returns  Iterator past the last element written to \c out
+ *
+ * \tparam  ArrayType    One-dimensional container type, e.g.
+ *                       \c dash::Array
+ * \tparam  IndexIter    Iterator type of the global indices
+ * \tparam  OutputIter   Random access iterator type of the result range
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ArrayType,
+  class IndexIter,
+  class OutputIter >
+OutputIter gather(
+  /// Container to read elements from
+  const ArrayType & array,
+  /// Iterator to the first global index
+  IndexIter         idx_first,
+  /// Iterator past the last global index
+  IndexIter         idx_last,
+  /// Iterator to the first element of the result range
+  OutputIter        out)
+{
+  typedef typename ArrayType::value_type value_t;
+  typedef typename ArrayType::index_type index_t;
+
+  auto & team    = array.pattern().team();
+  size_t myid    = team.myid();
+  auto   batches = dash::internal::group_by_owner(
+                     array.pattern(), idx_first, idx_last);
+  DASH_LOG_DEBUG("dash::gather()", "indices:", batches.lindex.size());
+
+  // Values of the requested elements, written by their owners:
+  size_t nvalues = batches.lindex.size();
+  auto & lindex  = dash::internal::batch_buffer<index_t, 0>(team, nvalues);
+  auto & values  = dash::internal::batch_buffer<value_t, 1>(team, nvalues);
+  std::copy(batches.lindex.begin(), batches.lindex.end(), lindex.begin());
+  auto lindex_gptr = dash::internal::register_batch(team, lindex);
+  auto values_gptr = dash::internal::register_batch(team, values);
+  auto recv_sections = dash::internal::exchange_batch_sections(
+                         team, batches.sections);
+
+  std::vector<index_t>       recv_lindex;
+  std::vector<dart_handle_t> handles;
+  dash::internal::fetch_batches(
+    team, lindex_gptr, recv_sections, recv_lindex, handles);
+
+  const value_t * lmem = array.lbegin();
+  for (size_t i  = batches.sections[2 * myid + 1],
+              ie = i + batches.sections[2 * myid];
+       i < ie; ++i) {
+    values[i] = lmem[batches.lindex[i]];
+  }
+  if (!handles.empty()) {
+    dart_waitall(handles.data(), handles.size());
+    handles.clear();
+  }
+
+  std::vector<value_t> reply(recv_lindex.size());
+  size_t recv_offset = 0;
+  for (size_t u = 0; u < recv_sections.size() / 2; ++u) {
+    auto count = recv_sections[2 * u];
+    if (count == 0 || u == myid) {
+      continue;
+    }
+    for (size_t i = recv_offset; i < recv_offset + count; ++i) {
+      reply[i] = lmem[recv_lindex[i]];
+    }
+    dart_handle_t handle;
+    dash::internal::put_handle(
+      dash::internal::batch_gptr<value_t>(
+        values_gptr, team_unit_t(u), recv_sections[2 * u + 1]),
+      reply.data() + recv_offset, count, &handle);
+    if (handle != DART_HANDLE_NULL) {
+      handles.push_back(handle);
+    }
+    recv_offset += count;
+  }
+  if (!handles.empty()) {
+    dart_waitall(handles.data(), handles.size());
+  }
+  // Values are complete once all owners wrote them:
+  team.barrier();
+  DASH_ASSERT_RETURNS(dart_team_memderegister(values_gptr), DART_OK);
+  DASH_ASSERT_RETURNS(dart_team_memderegister(lindex_gptr), DART_OK);
+
+  for (size_t i = 0; i < nvalues; ++i) {
+    out[batches.pos[i]] = values[i];
+  }
+  DASH_LOG_DEBUG("dash::gather >");
+  return out + nvalues;
+}
+
+/**
+ * Combines the elements of \c array at the global indices in the range
+ * [idx_first, idx_last) with the values in the range beginning at
+ * \c val_first, so that <tt>array[idx] = op(array[idx], val)</tt>.
+ *
+ * Indices and values are grouped by the units owning the elements. Every
+ * owner fetches the indices and values of a unit in a single transfer each
+ * and applies them to its local elements, instead of one remote access per
+ * element.
+ *
+ * Collective operation, every unit specifies its own, possibly empty,
+ * range of indices. The order in which values of different units are
+ * applied is unspecified, so \c op should be commutative.
+ *
+ * \tparam  ArrayType    One-dimensional container type, e.g.
+ *                       \c dash::Array
+ * \tparam  IndexIter    Iterator type of the global indices
+ * \tparam  ValueIter    Random access iterator type of the values
+ * \tparam  BinaryOp     Binary operation, e.g. \c dash::plus
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ArrayType,
+  class IndexIter,
+  class ValueIter,
+  class BinaryOp >
+void scatter_accumulate(
+  /// Container to update
+  ArrayType & array,
+  /// Iterator to the first global index
+  IndexIter   idx_first,
+  /// Iterator past the last global index
+  IndexIter   idx_last,
+  /// Iterator to the value of the first global index
+  ValueIter   val_first,
+  /// Operation combining element and value
+  BinaryOp    op)
+{
+  typedef typename ArrayType::value_type value_t;
+  typedef typename ArrayType::index_type index_t;
+
+  auto & team    = array.pattern().team();
+  size_t myid    = team.myid();
+  auto   batches = dash::internal::group_by_owner(
+                     array.pattern(), idx_first, idx_last);
+  DASH_LOG_DEBUG("dash::scatter_accumulate()",
+                 "indices:", batches.lindex.size());
+
+  size_t nvalues = batches.lindex.size();
+  auto & lindex  = dash::internal::batch_buffer<index_t, 0>(team, nvalues);
+  auto & values  = dash::internal::batch_buffer<value_t, 1>(team, nvalues);
+  std::copy(batches.lindex.begin(), batches.lindex.end(), lindex.begin());
+  for (size_t i = 0; i < nvalues; ++i) {
+    values[i] = val_first[batches.pos[i]];
+  }
+  auto lindex_gptr = dash::internal::register_batch(team, lindex);
+  auto values_gptr = dash::internal::register_batch(team, values);
+  auto recv_sections = dash::internal::exchange_batch_sections(
+                         team, batches.sections);
+
+  std::vector<index_t>       recv_lindex;
+  std::vector<value_t>       recv_values;
+  std::vector<dart_handle_t> handles;
+  dash::internal::fetch_batches(
+    team, lindex_gptr, recv_sections, recv_lindex, handles);
+  dash::internal::fetch_batches(
+    team, values_gptr, recv_sections, recv_values, handles);
+
+  // Apply the values of the calling unit while fetching the others:
+  value_t * lmem = array.lbegin();
+  for (size_t i  = batches.sections[2 * myid + 1],
+              ie = i + batches.sections[2 * myid];
+       i < ie; ++i) {
+    auto & elem = lmem[batches.lindex[i]];
+    elem = op(elem, values[i]);
+  }
+  if (!handles.empty()) {
+    dart_waitall(handles.data(), handles.size());
+  }
+  for (size_t i = 0; i < recv_lindex.size(); ++i) {
+    auto & elem = lmem[recv_lindex[i]];
+    elem = op(elem, recv_values[i]);
+  }
+  // Batches must remain registered until all units fetched them:
+  team.barrier();
+  DASH_ASSERT_RETURNS(dart_team_memderegister(values_gptr), DART_OK);
+  DASH_ASSERT_RETURNS(dart_team_memderegister(lindex_gptr), DART_OK);
+  DASH_LOG_DEBUG("dash::scatter_accumulate >");
+}
+
+/**
+ * Assigns the values in the range beginning at \c val_first to the
+ * elements of \c array at the global indices in the range
+ * [idx_first, idx_last).
+ *
+ * Indices and values are exchanged in batches grouped by owner, see
+ * \c dash::scatter_accumulate. If several units specify the same index,
+ * it is unspecified which of their values is assigned.
+ *
+ * Collective operation, every unit specifies its own, possibly empty,
+ * range of indices.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ArrayType,
+  class IndexIter,
+  class ValueIter >
+void scatter(
+  /// Container to update
+  ArrayType & array,
+  /// Iterator to the first global index
+  IndexIter   idx_first,
+  /// Iterator past the last global index
+  IndexIter   idx_last,
+  /// Iterator to the value of the first global index
+  ValueIter   val_first)
+{
+  dash::scatter_accumulate(
+    array, idx_first, idx_last, val_first,
+    dash::second<typename ArrayType::value_type>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__GATHER_SCATTER_H__INCLUDED
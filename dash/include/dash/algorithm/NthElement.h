@@ -0,0 +1,622 @@
+#ifndef DASH__ALGORITHM__NTH_ELEMENT_H__INCLUDED
+#define DASH__ALGORITHM__NTH_ELEMENT_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Meta.h>
+#include <dash/Onesided.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/GatherScatter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Sort.h>
+#include <dash/algorithm/internal/UnitRange.h>
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace detail {
+
+/// Number of keys sampled by all units in a round of the selection.
+constexpr std::size_t select__nsamples         = 256;
+/// Number of remaining candidates which are gathered at every unit to
+/// select the key directly.
+constexpr std::size_t select__gather_threshold = 1 << 14;
+
+/**
+ * Result of the distributed selection.
+ */
+template <typename MappedType>
+struct select__result {
+  /// Key of the element of the requested rank
+  MappedType  key;
+  /// Number of elements in the range with a smaller key
+  std::size_t nless;
+};
+
+/**
+ * Finds the key of the element of rank \c k in the order of keys of the
+ * local elements of all units.
+ *
+ * Every round samples the remaining candidate keys of all units, counts the
+ * candidates between and equal to the sorted samples in a global histogram
+ * and keeps the candidates in the interval containing rank \c k. Candidates
+ * are gathered at every unit once few remain. As the samples are candidate
+ * keys, every round removes at least the candidates equal to a sample,
+ * independent of the distribution of the keys.
+ *
+ * Collective operation.
+ */
+template <typename ValueType, class SortableHash>
+auto select__kth_key(
+  dash::Team      & team,
+  const ValueType * lbegin,
+  std::size_t       nlocal,
+  std::size_t       k,
+  SortableHash      sortable_hash)
+-> select__result<
+     typename std::decay<typename dash::functional::closure_traits<
+       SortableHash>::result_type>::type>
+{
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  std::vector<mapped_type> cand(nlocal);
+  std::transform(lbegin, lbegin + nlocal, cand.begin(), sortable_hash);
+
+  std::size_t ncand = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &nlocal, &ncand, 1, dash::dart_datatype<std::size_t>::value,
+      DART_OP_SUM, team.dart_id()),
+    DART_OK);
+  DASH_ASSERT(k < ncand);
+
+  std::size_t nbelow = 0;
+  int         nthreads = psort__num_threads(nlocal);
+  for (int round = 0; ; ++round) {
+    DASH_LOG_TRACE("dash::select__kth_key", "round:", round,
+                   "candidates:", ncand, "rank:", k);
+    if (ncand <= select__gather_threshold) {
+      auto all = allgather_vectors(team, cand);
+      std::nth_element(all.begin(), all.begin() + k, all.end());
+      auto key = all[k];
+      return select__result<mapped_type> {
+        key,
+        nbelow + static_cast<std::size_t>(
+                   std::count_if(all.begin(), all.end(),
+                                 [key](const mapped_type & c) {
+                                   return c < key;
+                                 }))
+      };
+    }
+
+    // Samples at evenly spaced positions, their number is proportional to
+    // the number of local candidates:
+    std::size_t nsamples = (select__nsamples * cand.size() + ncand - 1)
+                           / ncand;
+    std::vector<mapped_type> l_samples(nsamples);
+    for (std::size_t s = 0; s < nsamples; ++s) {
+      l_samples[s] = cand[(2 * s + 1) * cand.size() / (2 * nsamples)];
+    }
+    auto splitters = allgather_vectors(team, l_samples);
+    std::sort(splitters.begin(), splitters.end());
+    splitters.erase(
+      std::unique(splitters.begin(), splitters.end()), splitters.end());
+    auto const nsplitters = splitters.size();
+
+    // Histogram of 2 * nsplitters + 1 bins: bin 2j counts the candidates
+    // between splitters j-1 and j, bin 2j+1 the candidates equal to
+    // splitter j.
+    auto const nbins = 2 * nsplitters + 1;
+    std::vector<std::size_t> t_histo(nthreads * nbins, 0);
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+    for (int t = 0; t < nthreads; ++t) {
+      auto * histo = t_histo.data() + t * nbins;
+      auto   first = cand.size() * t / nthreads;
+      auto   last  = cand.size() * (t + 1) / nthreads;
+      for (auto i = first; i < last; ++i) {
+        auto j = std::lower_bound(
+                   splitters.begin(), splitters.end(), cand[i]) -
+                 splitters.begin();
+        bool eq = (static_cast<std::size_t>(j) < nsplitters &&
+                   !(cand[i] < splitters[j]));
+        ++histo[2 * j + (eq ? 1 : 0)];
+      }
+    }
+    std::vector<std::size_t> l_histo(nbins, 0);
+    for (int t = 0; t < nthreads; ++t) {
+      std::transform(
+        l_histo.begin(), l_histo.end(), t_histo.begin() + t * nbins,
+        l_histo.begin(), std::plus<std::size_t>());
+    }
+    std::vector<std::size_t> g_histo(nbins);
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        l_histo.data(), g_histo.data(), nbins,
+        dash::dart_datatype<std::size_t>::value, DART_OP_SUM,
+        team.dart_id()),
+      DART_OK);
+
+    std::size_t acc = 0;
+    std::size_t bin = 0;
+    while (k >= acc + g_histo[bin]) {
+      acc += g_histo[bin];
+      ++bin;
+    }
+    if (bin % 2 == 1) {
+      // rank k is a key equal to a splitter
+      return select__result<mapped_type> {
+        splitters[bin / 2], nbelow + acc };
+    }
+    k      -= acc;
+    nbelow += acc;
+    ncand   = g_histo[bin];
+
+    // Keep the candidates between the splitters adjacent to the bin:
+    auto const j = bin / 2;
+    cand.erase(
+      std::remove_if(
+        cand.begin(), cand.end(),
+        [&](const mapped_type & c) {
+          return (j > 0 && !(splitters[j - 1] < c)) ||
+                 (j < nsplitters && !(c < splitters[j]));
+        }),
+      cand.end());
+  }
+}
+
+/**
+ * Classifies the local elements by their key relative to the key of rank
+ * \c rank (see \c select__kth_key): elements ranked below \c rank in the
+ * order of keys and positions are of class 0, the element of rank \c rank
+ * is of class 1 and all other elements are of class 2. Elements equal to
+ * the key are ranked by their position in the range.
+ *
+ * Collective operation.
+ */
+template <typename ValueType, typename MappedType, class SortableHash>
+std::vector<std::uint8_t> select__classify(
+  dash::Team                       & team,
+  const unit_range<ValueType>      & range,
+  const select__result<MappedType> & kth,
+  std::size_t                        rank,
+  SortableHash                       sortable_hash)
+{
+  std::vector<std::uint8_t> classes(range.nlocal);
+  std::size_t               l_nequal = 0;
+  for (std::size_t i = 0; i < range.nlocal; ++i) {
+    auto key = sortable_hash(range.lbegin[i]);
+    if (key < kth.key) {
+      classes[i] = 0;
+    } else if (kth.key < key) {
+      classes[i] = 2;
+    } else {
+      // preliminary class, replaced by the rank of the equal element below
+      classes[i] = 3;
+      ++l_nequal;
+    }
+  }
+  std::vector<std::size_t> nequal(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_nequal, nequal.data(), 1,
+      dash::dart_datatype<std::size_t>::value, team.dart_id()),
+    DART_OK);
+  // Rank of the first local element equal to the key among all elements
+  // equal to the key:
+  std::size_t eq_rank = std::accumulate(
+                          nequal.begin(), nequal.begin() + team.myid(),
+                          std::size_t(0));
+  std::size_t eq_nth  = rank - kth.nless;
+  for (auto & c : classes) {
+    if (c == 3) {
+      c = (eq_rank < eq_nth) ? 0 : (eq_rank == eq_nth) ? 1 : 2;
+      ++eq_rank;
+    }
+  }
+  return classes;
+}
+
+/**
+ * Moves the elements of the range to the sections of their classes,
+ * elements of class \c c are moved to positions in
+ * <tt>[borders[c], borders[c+1])</tt>. The number of elements of every
+ * class must match the size of its section.
+ *
+ * Only misplaced elements are moved: the i-th misplaced element of a class
+ * in the order of positions is moved to the i-th position in the section
+ * of the class holding a misplaced element of another class. Every unit
+ * receives the elements for its misplaced positions in a registered buffer
+ * in one transfer per sending unit and class.
+ *
+ * Collective operation.
+ */
+template <typename ValueType>
+void select__place_classes(
+  dash::Team                       & team,
+  const unit_range<ValueType>      & range,
+  const std::vector<std::uint8_t>  & classes,
+  const std::array<std::size_t, 4> & borders)
+{
+  constexpr std::size_t nclasses = 3;
+
+  auto const nunits = team.size();
+  auto const myid   = static_cast<std::size_t>(team.myid());
+  auto const offset = range.unit_offsets[myid];
+
+  auto section_of = [&](std::size_t pos) -> std::size_t {
+    return (pos < borders[1]) ? 0 : (pos < borders[2]) ? 1 : 2;
+  };
+
+  // Misplaced local elements packed by class, and number of misplaced
+  // elements and of misplaced positions of every class:
+  std::array<std::vector<ValueType>, nclasses> send;
+  std::array<std::size_t, 2 * nclasses>        l_counts {{ }};
+  for (std::size_t i = 0; i < range.nlocal; ++i) {
+    auto sec = section_of(offset + i);
+    if (classes[i] != sec) {
+      send[classes[i]].push_back(range.lbegin[i]);
+      ++l_counts[nclasses + sec];
+    }
+  }
+  for (std::size_t c = 0; c < nclasses; ++c) {
+    l_counts[c] = send[c].size();
+  }
+  std::vector<std::size_t> counts(2 * nclasses * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_counts.data(), counts.data(), 2 * nclasses,
+      dash::dart_datatype<std::size_t>::value, team.dart_id()),
+    DART_OK);
+  auto nsend = [&](std::size_t u, std::size_t c) {
+    return counts[u * 2 * nclasses + c];
+  };
+  auto nrecv = [&](std::size_t u, std::size_t c) {
+    return counts[u * 2 * nclasses + nclasses + c];
+  };
+
+  // Buffer receiving the elements for the misplaced local positions,
+  // ordered by class:
+  std::size_t l_nrecv = 0;
+  for (std::size_t c = 0; c < nclasses; ++c) {
+    l_nrecv += nrecv(myid, c);
+  }
+  auto & recv = dash::internal::batch_buffer<ValueType, 0>(team, l_nrecv);
+  auto recv_gptr = dash::internal::register_batch(team, recv);
+
+  std::vector<dart_handle_t> handles;
+  for (std::size_t c = 0; c < nclasses; ++c) {
+    // Rank of the first local misplaced element of class c among all
+    // misplaced elements of class c:
+    std::size_t rank = 0;
+    for (std::size_t u = 0; u < myid; ++u) {
+      rank += nsend(u, c);
+    }
+    std::size_t pos   = 0;
+    std::size_t u     = 0;
+    std::size_t u_beg = 0;
+    while (pos < send[c].size()) {
+      // advance to the unit receiving the element of the current rank
+      while (rank >= u_beg + nrecv(u, c)) {
+        u_beg += nrecv(u, c);
+        ++u;
+      }
+      auto ncopy = std::min(send[c].size() - pos, u_beg + nrecv(u, c) - rank);
+      // offset of the section of class c in the receive buffer of unit u
+      std::size_t u_offset = rank - u_beg;
+      for (std::size_t cc = 0; cc < c; ++cc) {
+        u_offset += nrecv(u, cc);
+      }
+      if (u == myid) {
+        std::copy(
+          send[c].begin() + pos, send[c].begin() + pos + ncopy,
+          recv.begin() + u_offset);
+      } else {
+        dart_handle_t handle;
+        dash::internal::put_handle(
+          dash::internal::batch_gptr<ValueType>(
+            recv_gptr, team_unit_t(u), u_offset),
+          send[c].data() + pos, ncopy, &handle);
+        if (handle != DART_HANDLE_NULL) {
+          handles.push_back(handle);
+        }
+      }
+      pos  += ncopy;
+      rank += ncopy;
+    }
+  }
+  if (!handles.empty()) {
+    dart_waitall(handles.data(), handles.size());
+  }
+  team.barrier();
+
+  std::array<std::size_t, nclasses> recv_pos {{ }};
+  for (std::size_t c = 1; c < nclasses; ++c) {
+    recv_pos[c] = recv_pos[c - 1] + nrecv(myid, c - 1);
+  }
+  for (std::size_t i = 0; i < range.nlocal; ++i) {
+    auto sec = section_of(offset + i);
+    if (classes[i] != sec) {
+      range.lbegin[i] = recv[recv_pos[sec]++];
+    }
+  }
+  team.barrier();
+  DASH_ASSERT_RETURNS(dart_team_memderegister(recv_gptr), DART_OK);
+}
+
+} // namespace detail
+
+/**
+ * Rearranges the elements in the range \c [first, last) such that the
+ * element at \c nth is the element that would be at this position if the
+ * range was sorted, all elements before \c nth are not greater and all
+ * elements after \c nth are not less than this element, compared by their
+ * keys obtained from \c sortable_hash as in \c dash::sort.
+ *
+ * The key of the element is found by a distributed selection which samples
+ * the keys of all units and narrows the range of candidate keys in global
+ * histograms. Only elements that are not already on the correct side of
+ * \c nth are moved, in a single exchange.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+void nth_element(
+  GlobRandomIt first,
+  GlobRandomIt nth,
+  GlobRandomIt last,
+  SortableHash sortable_hash)
+{
+  DASH_LOG_DEBUG("dash::nth_element()");
+  auto & team = first.pattern().team();
+  if (team == dash::Team::Null()) {
+    return;
+  }
+  if (first >= last || nth >= last) {
+    team.barrier();
+    return;
+  }
+  auto range = detail::unit_range_of(first, last);
+  std::size_t const rank = dash::distance(first, nth);
+  std::size_t const n    = range.unit_offsets.back();
+
+  auto kth     = detail::select__kth_key(
+                   team, range.lbegin, range.nlocal, rank, sortable_hash);
+  auto classes = detail::select__classify(
+                   team, range, kth, rank, sortable_hash);
+  detail::select__place_classes(
+    team, range, classes, {{ 0, rank, rank + 1, n }});
+  DASH_LOG_DEBUG("dash::nth_element >");
+}
+
+/**
+ * Rearranges the elements in the range \c [first, last) such that the
+ * element at \c nth is the element that would be at this position if the
+ * range was sorted, see \c dash::nth_element(first, nth, last, hash).
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+inline void nth_element(
+  GlobRandomIt first,
+  GlobRandomIt nth,
+  GlobRandomIt last)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::nth_element(first, nth, last, detail::identity_t<value_t const&>());
+}
+
+/**
+ * Rearranges the elements in the range \c [first, last) such that
+ * \c [first, middle) contains the smallest elements of the range in
+ * ascending order of their keys obtained from \c sortable_hash. The order
+ * of the elements in \c [middle, last) is unspecified.
+ *
+ * The key of the largest element in \c [first, middle) is found by a
+ * distributed selection (see \c dash::nth_element), elements belonging to
+ * \c [first, middle) that are located in \c [middle, last) are exchanged
+ * with the other elements in \c [first, middle), which are then sorted with
+ * \c dash::sort. At most <tt>2 * (middle - first)</tt> elements are moved
+ * in the selection.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+void partial_sort(
+  GlobRandomIt first,
+  GlobRandomIt middle,
+  GlobRandomIt last,
+  SortableHash sortable_hash)
+{
+  DASH_LOG_DEBUG("dash::partial_sort()");
+  auto & team = first.pattern().team();
+  if (team == dash::Team::Null()) {
+    return;
+  }
+  if (first >= middle) {
+    team.barrier();
+    return;
+  }
+  if (middle > last) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::partial_sort(): middle is not in range [first, last]");
+  }
+  if (middle < last) {
+    auto range = detail::unit_range_of(first, last);
+    std::size_t const k = dash::distance(first, middle);
+    std::size_t const n = range.unit_offsets.back();
+
+    // Elements of class 0 and 1 are the k smallest elements:
+    auto kth     = detail::select__kth_key(
+                     team, range.lbegin, range.nlocal, k - 1, sortable_hash);
+    auto classes = detail::select__classify(
+                     team, range, kth, k - 1, sortable_hash);
+    std::replace(classes.begin(), classes.end(), std::uint8_t(1),
+                 std::uint8_t(0));
+    detail::select__place_classes(team, range, classes, {{ 0, k, k, n }});
+  }
+  dash::sort(first, middle, sortable_hash);
+  DASH_LOG_DEBUG("dash::partial_sort >");
+}
+
+/**
+ * Rearranges the elements in the range \c [first, last) such that
+ * \c [first, middle) contains the smallest elements of the range in
+ * ascending order, see \c dash::partial_sort(first, middle, last, hash).
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+inline void partial_sort(
+  GlobRandomIt first,
+  GlobRandomIt middle,
+  GlobRandomIt last)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::partial_sort(
+    first, middle, last, detail::identity_t<value_t const&>());
+}
+
+/**
+ * Copies the \c k elements with the largest keys obtained from
+ * \c sortable_hash in the range \c [first, last) in descending order of
+ * their keys to the local range beginning at \c out, at every unit.
+ * Elements with equal keys are selected and ordered by their position in
+ * the range, as in a stable sort.
+ *
+ * The key of the k-th largest element is found by a distributed selection
+ * (see \c dash::nth_element), only the selected \c k elements are
+ * communicated. The range is not modified.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * \returns  Iterator past the last element written to \c out
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class OutputIt, class SortableHash>
+OutputIt top_k(
+  GlobRandomIt first,
+  GlobRandomIt last,
+  std::size_t  k,
+  OutputIt     out,
+  SortableHash sortable_hash)
+{
+  using value_type = typename GlobRandomIt::value_type;
+
+  DASH_LOG_DEBUG("dash::top_k()", "k:", k);
+  auto & team = first.pattern().team();
+  if (team == dash::Team::Null() || k == 0) {
+    return out;
+  }
+  auto range = detail::unit_range_of(first, last);
+  std::size_t const n = range.unit_offsets.back();
+  if (k > n) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::top_k(): k exceeds the size of the range");
+  }
+
+  // The k largest elements are the elements with keys greater than the key
+  // of rank n - k and the first elements with equal keys:
+  auto kth = detail::select__kth_key(
+               team, range.lbegin, range.nlocal, n - k, sortable_hash);
+  std::array<std::size_t, 2> l_counts {{ }};
+  for (std::size_t i = 0; i < range.nlocal; ++i) {
+    auto key = sortable_hash(range.lbegin[i]);
+    if (kth.key < key) {
+      ++l_counts[0];
+    } else if (!(key < kth.key)) {
+      ++l_counts[1];
+    }
+  }
+  std::vector<std::size_t> counts(2 * team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_counts.data(), counts.data(), 2,
+      dash::dart_datatype<std::size_t>::value, team.dart_id()),
+    DART_OK);
+  std::size_t nequal  = k;
+  std::size_t eq_rank = 0;
+  for (std::size_t u = 0; u < team.size(); ++u) {
+    nequal -= counts[2 * u];
+    if (u < static_cast<std::size_t>(team.myid())) {
+      eq_rank += counts[2 * u + 1];
+    }
+  }
+  std::vector<value_type> l_top;
+  for (std::size_t i = 0; i < range.nlocal; ++i) {
+    auto key = sortable_hash(range.lbegin[i]);
+    if (kth.key < key) {
+      l_top.push_back(range.lbegin[i]);
+    } else if (!(key < kth.key) && eq_rank++ < nequal) {
+      l_top.push_back(range.lbegin[i]);
+    }
+  }
+  auto top = detail::allgather_vectors(team, l_top);
+  DASH_ASSERT_EQ(top.size(), k, "invalid number of selected elements");
+  std::stable_sort(
+    top.begin(), top.end(),
+    [&sortable_hash](const value_type & a, const value_type & b) {
+      return sortable_hash(b) < sortable_hash(a);
+    });
+  DASH_LOG_DEBUG("dash::top_k >");
+  return std::copy(top.begin(), top.end(), out);
+}
+
+/**
+ * Copies the \c k largest elements in the range \c [first, last) in
+ * descending order to the local range beginning at \c out, at every unit,
+ * see \c dash::top_k(first, last, k, out, hash).
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class OutputIt>
+inline OutputIt top_k(
+  GlobRandomIt first,
+  GlobRandomIt last,
+  std::size_t  k,
+  OutputIt     out)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  return dash::top_k(
+           first, last, k, out, detail::identity_t<value_t const&>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__NTH_ELEMENT_H__INCLUDED
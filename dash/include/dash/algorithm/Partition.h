@@ -0,0 +1,312 @@
+#ifndef DASH__ALGORITHM__PARTITION_H__INCLUDED
+#define DASH__ALGORITHM__PARTITION_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/internal/UnitRange.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace detail {
+
+/**
+ * Moves packed blocks of local elements to consecutive positions in the
+ * range beginning at \c d_first. Block \c b of all units is placed after
+ * the blocks before \c b of all units, the blocks of the same index are
+ * ordered by unit. Positions are obtained from an exclusive scan over the
+ * block sizes of all units, every unit moves its blocks with one-sided puts
+ * of the runs contiguous at their destination units.
+ *
+ * The blocks are packed before the call, so \c d_first may be in the range
+ * the blocks were packed from.
+ *
+ * Collective operation.
+ *
+ * \returns  Global size of every block
+ */
+template <typename ValueType, class GlobOutputIt>
+std::vector<std::size_t> compact__move_blocks(
+  dash::Team                                 & team,
+  const std::vector<std::vector<ValueType>>  & blocks,
+  GlobOutputIt                                 d_first)
+{
+  static_assert(
+    std::is_same<
+      ValueType,
+      typename std::remove_cv<typename GlobOutputIt::value_type>::type
+    >::value,
+    "value types of source and destination range differ");
+
+  auto const nunits  = team.size();
+  auto const myid    = static_cast<std::size_t>(team.myid());
+  auto const nblocks = blocks.size();
+
+  std::vector<std::size_t> l_sizes(nblocks);
+  for (std::size_t b = 0; b < nblocks; ++b) {
+    l_sizes[b] = blocks[b].size();
+  }
+  std::vector<std::size_t> sizes(nunits * nblocks);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_sizes.data(), sizes.data(), nblocks,
+      dash::dart_datatype<std::size_t>::value, team.dart_id()),
+    DART_OK);
+
+  // Global block sizes and destination positions of the local blocks:
+  std::vector<std::size_t> g_sizes(nblocks, 0);
+  std::vector<std::size_t> positions(nblocks, 0);
+  std::size_t              n = 0;
+  for (std::size_t b = 0; b < nblocks; ++b) {
+    positions[b] = n;
+    for (std::size_t u = 0; u < nunits; ++u) {
+      if (u < myid) {
+        positions[b] += sizes[u * nblocks + b];
+      }
+      g_sizes[b] += sizes[u * nblocks + b];
+    }
+    n += g_sizes[b];
+  }
+
+  auto dst = unit_range_of(d_first, d_first + n);
+  // All units packed their blocks before elements are overwritten:
+  team.barrier();
+
+  std::vector<dart_handle_t> handles;
+  for (std::size_t b = 0; b < nblocks; ++b) {
+    const ValueType * values = blocks[b].data();
+    std::size_t       count  = blocks[b].size();
+    std::size_t       pos    = positions[b];
+    while (count > 0) {
+      auto unit  = static_cast<std::size_t>(
+                     std::upper_bound(
+                       dst.unit_offsets.begin(), dst.unit_offsets.end(),
+                       pos) -
+                     dst.unit_offsets.begin() - 1);
+      auto ncopy = std::min(count, dst.unit_offsets[unit + 1] - pos);
+      if (unit == myid) {
+        std::copy(values, values + ncopy,
+                  dst.lbegin + (pos - dst.unit_offsets[unit]));
+      } else {
+        dart_handle_t handle;
+        dash::internal::put_handle(
+          (d_first + pos).dart_gptr(), values, ncopy, &handle);
+        if (handle != DART_HANDLE_NULL) {
+          handles.push_back(handle);
+        }
+      }
+      values += ncopy;
+      pos    += ncopy;
+      count  -= ncopy;
+    }
+  }
+  if (!handles.empty()) {
+    dart_waitall(handles.data(), handles.size());
+  }
+  team.barrier();
+  return g_sizes;
+}
+
+} // namespace detail
+
+/**
+ * Copies the elements in the range \c [first, last) for which \c pred
+ * returns \c true to the global range beginning at \c d_first, keeping
+ * their order.
+ *
+ * Every unit filters its local elements, the positions of the copies are
+ * obtained from an exclusive scan over the number of copied elements of
+ * all units and the copies are moved to the units owning their positions
+ * in a single exchange. The result is distributed like the destination
+ * range.
+ *
+ * Both ranges must be ranges of one-dimensional containers in which the
+ * local elements of every unit are contiguous, as in \c dash::sort.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator past the last copied element in the destination range
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class UnaryPredicate >
+GlobOutputIt copy_if(
+  GlobInputIt    first,
+  GlobInputIt    last,
+  GlobOutputIt   d_first,
+  UnaryPredicate pred)
+{
+  using value_type = typename std::remove_cv<
+                       typename GlobInputIt::value_type>::type;
+
+  DASH_LOG_DEBUG("dash::copy_if()");
+  auto & team = first.pattern().team();
+  if (team == dash::Team::Null()) {
+    return d_first;
+  }
+  auto src = detail::unit_range_of(first, last);
+  std::vector<std::vector<value_type>> blocks(1);
+  std::copy_if(src.lbegin, src.lbegin + src.nlocal,
+               std::back_inserter(blocks[0]), pred);
+  auto sizes = detail::compact__move_blocks(team, blocks, d_first);
+  DASH_LOG_DEBUG("dash::copy_if >", "copied:", sizes[0]);
+  return d_first + sizes[0];
+}
+
+/**
+ * Removes the elements in the range \c [first, last) for which \c pred
+ * returns \c true. The remaining elements keep their order and are moved
+ * to the beginning of the range, see \c dash::copy_if. The values of the
+ * elements after the returned iterator are unspecified.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator past the last remaining element
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobRandomIt,
+  class UnaryPredicate >
+GlobRandomIt remove_if(
+  GlobRandomIt   first,
+  GlobRandomIt   last,
+  UnaryPredicate pred)
+{
+  return dash::copy_if(first, last, first,
+                       [&pred](const typename GlobRandomIt::value_type & v) {
+                         return !pred(v);
+                       });
+}
+
+/**
+ * Reorders the elements in the range \c [first, last) such that all
+ * elements for which \c pred returns \c true precede the elements for
+ * which it returns \c false. The relative order of the elements in both
+ * groups is preserved.
+ *
+ * The positions of the elements of both groups are obtained from an
+ * exclusive scan over the group sizes of all units, elements are moved to
+ * the units owning their positions in a single exchange.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator to the first element of the second group
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobRandomIt,
+  class UnaryPredicate >
+GlobRandomIt partition(
+  GlobRandomIt   first,
+  GlobRandomIt   last,
+  UnaryPredicate pred)
+{
+  using value_type = typename std::remove_cv<
+                       typename GlobRandomIt::value_type>::type;
+
+  DASH_LOG_DEBUG("dash::partition()");
+  auto & team = first.pattern().team();
+  if (team == dash::Team::Null()) {
+    return first;
+  }
+  auto src = detail::unit_range_of(first, last);
+  std::vector<std::vector<value_type>> blocks(2);
+  for (std::size_t i = 0; i < src.nlocal; ++i) {
+    blocks[pred(src.lbegin[i]) ? 0 : 1].push_back(src.lbegin[i]);
+  }
+  auto sizes = detail::compact__move_blocks(team, blocks, first);
+  DASH_LOG_DEBUG("dash::partition >", "first group:", sizes[0]);
+  return first + sizes[0];
+}
+
+/**
+ * Removes all but the first element of every group of consecutive
+ * elements in the range \c [first, last) that are equivalent according to
+ * \c pred. The remaining elements are moved to the beginning of the range,
+ * see \c dash::remove_if. The values of the elements after the returned
+ * iterator are unspecified.
+ *
+ * Every unit compares its first local element to the last element of the
+ * preceding units, so groups spanning several units are removed as well.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator past the last remaining element
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobRandomIt,
+  class BinaryPredicate >
+GlobRandomIt unique(
+  GlobRandomIt    first,
+  GlobRandomIt    last,
+  BinaryPredicate pred)
+{
+  using value_type = typename std::remove_cv<
+                       typename GlobRandomIt::value_type>::type;
+
+  DASH_LOG_DEBUG("dash::unique()");
+  auto & team = first.pattern().team();
+  if (team == dash::Team::Null()) {
+    return first;
+  }
+  auto src    = detail::unit_range_of(first, last);
+  auto offset = src.unit_offsets[team.myid()];
+  std::vector<std::vector<value_type>> blocks(1);
+  if (src.nlocal > 0) {
+    auto * lbegin = src.lbegin;
+    if (offset == 0 ||
+        !pred(static_cast<value_type>(first[offset - 1]), lbegin[0])) {
+      blocks[0].push_back(lbegin[0]);
+    }
+    for (std::size_t i = 1; i < src.nlocal; ++i) {
+      if (!pred(lbegin[i - 1], lbegin[i])) {
+        blocks[0].push_back(lbegin[i]);
+      }
+    }
+  }
+  auto sizes = detail::compact__move_blocks(team, blocks, first);
+  DASH_LOG_DEBUG("dash::unique >", "remaining:", sizes[0]);
+  return first + sizes[0];
+}
+
+/**
+ * Removes all but the first element of every group of consecutive equal
+ * elements in the range \c [first, last), see
+ * \c dash::unique(first, last, pred).
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+inline GlobRandomIt unique(
+  GlobRandomIt first,
+  GlobRandomIt last)
+{
+  using value_type = typename std::remove_cv<
+                       typename GlobRandomIt::value_type>::type;
+
+  return dash::unique(first, last, std::equal_to<value_type>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__PARTITION_H__INCLUDED
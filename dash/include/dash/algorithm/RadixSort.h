@@ -0,0 +1,478 @@
+#ifndef DASH__ALGORITHM__RADIX_SORT_H__INCLUDED
+#define DASH__ALGORITHM__RADIX_SORT_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Meta.h>
+#include <dash/Onesided.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/GatherScatter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Sort.h>
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+#include <dash/util/Trace.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace detail {
+
+/// Number of bits of a digit in a pass of the radix sort.
+constexpr int          radix_sort__digit_bits = 8;
+/// Number of buckets of a digit.
+constexpr std::size_t  radix_sort__nbuckets   = 1 << radix_sort__digit_bits;
+/// Number of digits extracted at once in the local histogram.
+constexpr std::size_t  radix_sort__block_size = 1024;
+
+/**
+ * Maps arithmetic keys to unsigned integers of at least 32 bits with the
+ * same order, so their binary digits can be sorted from least to most
+ * significant.
+ */
+template <typename T, class Enable = void>
+struct radix_sort__key;
+
+template <typename T>
+struct radix_sort__key<
+  T,
+  typename std::enable_if<std::is_integral<T>::value>::type>
+{
+  typedef typename std::conditional<
+            (sizeof(T) <= sizeof(std::uint32_t)),
+            std::uint32_t,
+            std::uint64_t
+          >::type type;
+
+  static type map(T key) noexcept
+  {
+    typedef typename std::make_unsigned<T>::type unsigned_t;
+    // Flipping the sign bit orders negative before positive values:
+    constexpr unsigned_t sign = std::is_signed<T>::value
+                                ? unsigned_t(1) << (sizeof(T) * 8 - 1)
+                                : unsigned_t(0);
+    return static_cast<type>(static_cast<unsigned_t>(key) ^ sign);
+  }
+};
+
+template <typename T>
+struct radix_sort__key<
+  T,
+  typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+  static_assert(
+    sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t),
+    "dash::radix_sort supports 32 and 64 bit floating point keys");
+
+  typedef typename std::conditional<
+            (sizeof(T) == sizeof(std::uint32_t)),
+            std::uint32_t,
+            std::uint64_t
+          >::type type;
+
+  static type map(T key) noexcept
+  {
+    constexpr type sign = type(1) << (sizeof(T) * 8 - 1);
+    type bits;
+    std::memcpy(&bits, &key, sizeof(T));
+    // Negative values are ordered by their inverted magnitude:
+    return (bits & sign) ? ~bits : (bits | sign);
+  }
+};
+
+/**
+ * Histograms of the digit at bit \c shift of the keys in \c values, one
+ * histogram of \c radix_sort__nbuckets counts per thread. Thread \c t
+ * counts the t-th of \c nthreads equally sized chunks of the range.
+ */
+template <typename ValueType, class KeyFn>
+std::vector<std::size_t> radix_sort__local_histograms(
+  const ValueType * values,
+  std::size_t       n,
+  KeyFn             key_of,
+  int               shift,
+  int               nthreads)
+{
+  typedef decltype(key_of(*values)) key_type;
+
+  std::vector<std::size_t> histo(nthreads * radix_sort__nbuckets, 0);
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    std::size_t * t_histo = histo.data() + t * radix_sort__nbuckets;
+    std::size_t   first   = n * t / nthreads;
+    std::size_t   last    = n * (t + 1) / nthreads;
+    // Digits are extracted in blocks in a vectorizable loop and counted
+    // separately, the counting loop cannot be vectorized due to conflicting
+    // increments:
+    std::array<std::uint16_t, radix_sort__block_size> digits;
+    for (std::size_t b = first; b < last; b += radix_sort__block_size) {
+      std::size_t nb = std::min(radix_sort__block_size, last - b);
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+      #pragma omp simd
+#endif
+      for (std::size_t i = 0; i < nb; ++i) {
+        digits[i] = static_cast<std::uint16_t>(
+                      (key_of(values[b + i]) >> shift) &
+                      key_type(radix_sort__nbuckets - 1));
+      }
+      for (std::size_t i = 0; i < nb; ++i) {
+        ++t_histo[digits[i]];
+      }
+    }
+  }
+  return histo;
+}
+
+/**
+ * Stable counting sort of \c values by the digit at bit \c shift into
+ * \c out, using the per-thread histograms from
+ * \c radix_sort__local_histograms.
+ */
+template <typename ValueType, class KeyFn>
+void radix_sort__local_scatter(
+  const ValueType                * values,
+  std::size_t                      n,
+  KeyFn                            key_of,
+  int                              shift,
+  int                              nthreads,
+  const std::vector<std::size_t> & histo,
+  ValueType                      * out)
+{
+  typedef decltype(key_of(*values)) key_type;
+
+  // Offset of the first element of every thread in every bucket, buckets
+  // are ordered by digit and threads within a bucket by their chunk:
+  std::vector<std::size_t> offsets(histo.size());
+  std::size_t offset = 0;
+  for (std::size_t d = 0; d < radix_sort__nbuckets; ++d) {
+    for (int t = 0; t < nthreads; ++t) {
+      offsets[t * radix_sort__nbuckets + d] = offset;
+      offset += histo[t * radix_sort__nbuckets + d];
+    }
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    std::size_t * t_offsets = offsets.data() + t * radix_sort__nbuckets;
+    std::size_t   first     = n * t / nthreads;
+    std::size_t   last      = n * (t + 1) / nthreads;
+    for (std::size_t i = first; i < last; ++i) {
+      auto digit = (key_of(values[i]) >> shift) &
+                   key_type(radix_sort__nbuckets - 1);
+      out[t_offsets[digit]++] = values[i];
+    }
+  }
+}
+
+} // namespace detail
+
+/**
+ * Sorts the elements in the range \c [begin, end) in ascending order of
+ * their keys with a distributed least significant digit radix sort. Equal
+ * keys keep their order.
+ *
+ * Keys are obtained from the elements with the function \c sortable_hash
+ * as in \c dash::sort and must be integral or 32 or 64 bit floating point
+ * values. Only the significant bits of the global key range are sorted,
+ * one digit of 8 bits per pass. Every pass counts the digits of the local
+ * elements, computes the final position of every local bucket from an
+ * exclusive scan and a reduction of the histograms and moves the buckets
+ * to their positions in a single exchange of one-sided puts. Passes in
+ * which all keys have the same digit are skipped.
+ *
+ * In contrast to \c dash::sort, the number of passes only depends on the
+ * range of the keys and not on their distribution, every pass moves all
+ * elements, however.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<double> arr(100);
+ *       dash::generate(arr.begin(), arr.end(), random());
+ *       dash::radix_sort(arr.begin(), arr.end());
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+void radix_sort(
+  GlobRandomIt begin,
+  GlobRandomIt end,
+  SortableHash sortable_hash)
+{
+  using iter_type   = GlobRandomIt;
+  using value_type  = typename iter_type::value_type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value,
+      "Only arithmetic types are supported");
+
+  using radix_key   = detail::radix_sort__key<mapped_type>;
+  using key_type    = typename radix_key::type;
+
+  constexpr auto nbuckets = detail::radix_sort__nbuckets;
+
+  auto pattern = begin.pattern();
+
+  dash::util::Trace trace("RadixSort");
+
+  if (pattern.team() == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::radix_sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+  dash::Team & team = pattern.team();
+  if (begin >= end) {
+    DASH_LOG_TRACE("dash::radix_sort", "empty range");
+    team.barrier();
+    return;
+  }
+
+  auto const nunits = team.size();
+  auto const myid   = team.myid();
+
+  auto const l_range = dash::local_index_range(begin, end);
+
+  auto * l_mem_begin = dash::local_begin(
+      static_cast<typename iter_type::pointer>(begin), myid);
+
+  std::size_t const n_l_elem = l_range.end - l_range.begin;
+
+  auto * lbegin = l_mem_begin + l_range.begin;
+  auto * lend   = l_mem_begin + l_range.end;
+
+  auto const nthreads = detail::psort__num_threads(n_l_elem);
+
+  trace.enter_state("1:find_global_key_range");
+
+  // Global minimum and maximum key, only the bits in which the keys differ
+  // from the minimum are sorted:
+  std::array<key_type, 2> l_min_max {{
+    std::numeric_limits<key_type>::max(),
+    std::numeric_limits<key_type>::min() }};
+  for (auto * it = lbegin; it != lend; ++it) {
+    auto key = radix_key::map(sortable_hash(*it));
+    l_min_max[0] = std::min(l_min_max[0], key);
+    l_min_max[1] = std::max(l_min_max[1], key);
+  }
+  std::array<key_type, 2> min_max;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      l_min_max.data(), min_max.data(), 2,
+      dash::dart_datatype<key_type>::value, DART_OP_MINMAX, team.dart_id()),
+    DART_OK);
+
+  key_type const key_min = min_max[0];
+  int            nbits   = 0;
+  for (key_type range = min_max[1] - key_min; range != 0; range >>= 1) {
+    ++nbits;
+  }
+  DASH_LOG_TRACE("dash::radix_sort", "key range:", min_max[0], min_max[1],
+                 "significant bits:", nbits);
+
+  trace.exit_state("1:find_global_key_range");
+
+  if (nbits == 0) {
+    // all keys are equal, nothing to sort
+    team.barrier();
+    return;
+  }
+
+  auto const key_of = [&sortable_hash, key_min](const value_type & v) {
+    return static_cast<key_type>(radix_key::map(sortable_hash(v)) - key_min);
+  };
+
+  trace.enter_state("2:init_temporary_data");
+
+  // Offsets of the local ranges of all units in the sorted range:
+  std::vector<std::size_t> unit_offsets(nunits + 1, 0);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &n_l_elem, unit_offsets.data() + 1, 1,
+      dash::dart_datatype<std::size_t>::value, team.dart_id()),
+    DART_OK);
+  std::partial_sum(
+    unit_offsets.begin(), unit_offsets.end(), unit_offsets.begin());
+  std::size_t const n_elem = unit_offsets.back();
+
+  // Elements are moved between two registered buffers, every pass reads
+  // the local elements from one buffer and writes them to the other buffer
+  // of their new owners:
+  std::array<std::vector<value_type> *, 2> bufs {{
+    &dash::internal::batch_buffer<value_type, 0>(team, n_l_elem),
+    &dash::internal::batch_buffer<value_type, 1>(team, n_l_elem) }};
+  std::copy(lbegin, lend, bufs[0]->begin());
+  std::array<dart_gptr_t, 2> buf_gptrs {{
+    dash::internal::register_batch(team, *bufs[0]),
+    dash::internal::register_batch(team, *bufs[1]) }};
+  std::vector<value_type>    sorted(n_l_elem);
+  std::vector<std::size_t>   l_histo(nbuckets);
+  std::vector<std::size_t>   g_histo(nbuckets);
+  std::vector<std::size_t>   u_histo(nbuckets);
+  std::vector<dart_handle_t> handles;
+  int                        cur = 0;
+
+  trace.exit_state("2:init_temporary_data");
+
+  for (int shift = 0; shift < nbits; shift += detail::radix_sort__digit_bits) {
+    DASH_LOG_TRACE("dash::radix_sort", "pass, shift:", shift);
+
+    trace.enter_state("3:local_histogram");
+    auto const t_histo = detail::radix_sort__local_histograms(
+                           bufs[cur]->data(), n_l_elem, key_of, shift,
+                           nthreads);
+    std::fill(l_histo.begin(), l_histo.end(), 0);
+    for (int t = 0; t < nthreads; ++t) {
+      std::transform(
+        l_histo.begin(), l_histo.end(), t_histo.begin() + t * nbuckets,
+        l_histo.begin(), std::plus<std::size_t>());
+    }
+    trace.exit_state("3:local_histogram");
+
+    trace.enter_state("4:global_histogram (exscan, allreduce)");
+    // Number of elements of every digit at units with smaller ids:
+    DASH_ASSERT_RETURNS(
+      dart_exscan(
+        l_histo.data(), u_histo.data(), nbuckets,
+        dash::dart_datatype<std::size_t>::value, DART_OP_SUM,
+        team.dart_id()),
+      DART_OK);
+    if (myid.id == 0) {
+      std::fill(u_histo.begin(), u_histo.end(), 0);
+    }
+    // Number of elements of every digit at all units:
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        l_histo.data(), g_histo.data(), nbuckets,
+        dash::dart_datatype<std::size_t>::value, DART_OP_SUM,
+        team.dart_id()),
+      DART_OK);
+
+    // Position of the first local element of every bucket in the sorted
+    // range: elements of smaller digits, followed by the elements of the
+    // same digit at units with smaller ids.
+    std::vector<std::size_t> bucket_offsets(nbuckets);
+    std::size_t offset = 0;
+    bool        skip   = false;
+    for (std::size_t d = 0; d < nbuckets; ++d) {
+      bucket_offsets[d] = offset + u_histo[d];
+      skip    = skip || (g_histo[d] == n_elem);
+      offset += g_histo[d];
+    }
+    trace.exit_state("4:global_histogram (exscan, allreduce)");
+
+    if (skip) {
+      DASH_LOG_TRACE("dash::radix_sort", "all keys have the same digit");
+      continue;
+    }
+
+    trace.enter_state("5:local_scatter");
+    detail::radix_sort__local_scatter(
+      bufs[cur]->data(), n_l_elem, key_of, shift, nthreads, t_histo,
+      sorted.data());
+    trace.exit_state("5:local_scatter");
+
+    trace.enter_state("6:exchange_data (all-to-all)");
+    // Buckets are split at the borders of the local ranges of their
+    // destination units:
+    auto & next = *bufs[1 - cur];
+    std::size_t l_pos = 0;
+    for (std::size_t d = 0; d < nbuckets; ++d) {
+      std::size_t g_pos = bucket_offsets[d];
+      std::size_t count = l_histo[d];
+      while (count > 0) {
+        auto unit = static_cast<std::size_t>(
+                      std::upper_bound(
+                        unit_offsets.begin(), unit_offsets.end(), g_pos) -
+                      unit_offsets.begin() - 1);
+        auto ncopy = std::min(count, unit_offsets[unit + 1] - g_pos);
+        auto u_pos = g_pos - unit_offsets[unit];
+        if (unit == static_cast<std::size_t>(myid)) {
+          std::copy(
+            sorted.begin() + l_pos, sorted.begin() + l_pos + ncopy,
+            next.begin() + u_pos);
+        } else {
+          dart_handle_t handle;
+          dash::internal::put_handle(
+            dash::internal::batch_gptr<value_type>(
+              buf_gptrs[1 - cur], team_unit_t(unit), u_pos),
+            sorted.data() + l_pos, ncopy, &handle);
+          if (handle != DART_HANDLE_NULL) {
+            handles.push_back(handle);
+          }
+        }
+        g_pos += ncopy;
+        l_pos += ncopy;
+        count -= ncopy;
+      }
+    }
+    if (!handles.empty()) {
+      dart_waitall(handles.data(), handles.size());
+      handles.clear();
+    }
+    trace.exit_state("6:exchange_data (all-to-all)");
+
+    trace.enter_state("7:barrier");
+    team.barrier();
+    trace.exit_state("7:barrier");
+
+    cur = 1 - cur;
+  }
+
+  std::copy(bufs[cur]->begin(), bufs[cur]->begin() + n_l_elem, lbegin);
+
+  DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
+
+  trace.enter_state("8:final_barrier");
+  team.barrier();
+  trace.exit_state("8:final_barrier");
+
+  DASH_ASSERT_RETURNS(dart_team_memderegister(buf_gptrs[0]), DART_OK);
+  DASH_ASSERT_RETURNS(dart_team_memderegister(buf_gptrs[1]), DART_OK);
+}
+
+/**
+ * Sorts the arithmetic elements in the range \c [begin, end) in ascending
+ * order with a distributed radix sort, see
+ * \c dash::radix_sort(begin, end, sortable_hash).
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+inline void radix_sort(GlobRandomIt begin, GlobRandomIt end)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::radix_sort(begin, end, detail::identity_t<value_t const&>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__RADIX_SORT_H__INCLUDED
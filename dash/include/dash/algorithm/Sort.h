@@ -15,8 +15,14 @@
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/LocalRange.h>
 
+#include <dash/internal/Config.h>
 #include <dash/internal/Logging.h>
 #include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace dash {
 
@@ -117,7 +123,11 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   if (pattern.team().size() == 1) {
     DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
     trace.enter_state("final_local_sort");
-    std::sort(begin.local(), end.local(), sort_comp);
+    detail::psort__local_sort(
+        begin.local(),
+        end.local(),
+        sort_comp,
+        detail::psort__num_threads(std::distance(begin.local(), end.local())));
     trace.exit_state("final_local_sort");
     return;
   }
@@ -147,9 +157,12 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto * lbegin = l_mem_begin + l_range.begin;
   auto * lend   = l_mem_begin + l_range.end;
 
+  // threads used in the local sort and merge phases
+  auto const nthreads = detail::psort__num_threads(n_l_elem);
+
   // initial local_sort
   trace.enter_state("1:initial_local_sort");
-  std::sort(lbegin, lend, sort_comp);
+  detail::psort__local_sort(lbegin, lend, sort_comp, nthreads);
   trace.exit_state("1:initial_local_sort");
 
   trace.enter_state("2:init_temporary_global_data");
@@ -167,8 +180,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("3:find_global_min_max");
 
-  // Temporary local buffer (sorted);
-  std::vector<value_type> const lcopy(lbegin, lend);
+  // Temporary local buffer (sorted), reused as merge buffer in the final
+  // step
+  std::vector<value_type> lcopy(lbegin, lend);
 
   auto const min_max = detail::find_global_min_max(
       std::begin(lcopy), std::end(lcopy), team.dart_id(), sortable_hash);
@@ -565,20 +579,14 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.exit_state("17:exchange_data (all-to-all)");
 
-  /* NOTE: While merging locally sorted sequences is faster than another
-   * heavy-weight sort it comes at a cost. std::inplace_merge allocates a
-   * temporary buffer internally which is also documented on cppreference. If
-   * the allocation of this buffer fails, a less efficient merge method is
-   * used. However, in Linux, the allocation nevers fails since the
-   * implementation simply allocates memory using malloc and the kernel follows
-   * the optimistic strategy. This is ugly and can lead to a segmentation fault
-   * later if no physical pages are available to map the allocated
-   * virtual memory.
+  /* NOTE: The received partitions are sorted sequences, one per unit. They
+   * are merged in a single k-way merge into the temporary local buffer,
+   * which is no longer needed once the data exchange is complete, instead
+   * of log(p) passes of std::inplace_merge which allocate a temporary
+   * buffer internally.
    *
-   *
-   * std::sort does not suffer from this problem and may be a more safe
-   * variant, especially if the user wants to utilize the fully available
-   * memory capacity on its own.
+   * Sorting the received elements again is an alternative if the
+   * partitions are not sorted.
    */
 
 #if (__DASH_SORT__FINAL_STEP_STRATEGY == __DASH_SORT__FINAL_STEP_BY_SORT)
@@ -587,7 +595,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   trace.exit_state("18:barrier");
 
   trace.enter_state("19:final_local_sort");
-  std::sort(lbegin, lend);
+  detail::psort__local_sort(lbegin, lend, sort_comp, nthreads);
   trace.exit_state("19:final_local_sort");
 #else
   trace.enter_state("18:calc_recv_count (all-to-all)");
@@ -614,51 +622,30 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("19:merge_local_sequences");
 
-  // merging sorted sequences
-  auto nsequences = nunits;
-  // number of merge steps in the tree
-  auto const depth = static_cast<size_t>(std::ceil(std::log2(nsequences)));
+  // sorted sequences received from every unit
+  std::vector<std::pair<value_type*, value_type*>> sequences;
+  sequences.reserve(nunits);
+
+  auto* seq_begin = lbegin;
+  for (auto const count : recv_count) {
+    if (count > 0) {
+      sequences.emplace_back(seq_begin, seq_begin + count);
+      seq_begin += count;
+    }
+  }
 
-  // calculate the prefix sum among all receive counts to find the offsets for
-  // merging
-  std::vector<size_t> recv_count_psum;
-  recv_count_psum.reserve(nsequences + 1);
-  recv_count_psum.emplace_back(0);
+  DASH_ASSERT_EQ(
+      seq_begin, lend, "received elements must fill the local range");
 
-  std::partial_sum(
-      std::begin(recv_count),
-      std::end(recv_count),
-      std::back_inserter(recv_count_psum));
+  if (sequences.size() > 1) {
+    detail::psort__merge_runs(sequences, lcopy.begin(), sort_comp, nthreads);
 
-  DASH_LOG_TRACE_RANGE(
-      "recv count prefix sum",
-      std::begin(recv_count_psum),
-      std::end(recv_count_psum));
-
-  for (std::size_t d = 0; d < depth; ++d) {
-    // distance between first and mid iterator while merging
-    auto const step = std::size_t(0x1) << d;
-    // distance between first and last iterator while merging
-    auto const dist = step << 1;
-    // number of merges
-    auto const nmerges = nsequences >> 1;
-
-    // These merges are independent from each other and are candidates for
-    // shared memory parallelism
-    for (std::size_t m = 0; m < nmerges; ++m) {
-      auto first = std::next(lbegin, recv_count_psum[m * dist]);
-      auto mid   = std::next(lbegin, recv_count_psum[m * dist + step]);
-      // sometimes we have a lonely merge in the end, so we have to guarantee
-      // that we do not access out of bounds
-      auto last = std::next(
-          lbegin,
-          recv_count_psum[std::min(
-              m * dist + dist, recv_count_psum.size() - 1)]);
-
-      std::inplace_merge(first, mid, last);
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+    for (std::ptrdiff_t i = 0; i < n_l_elem; ++i) {
+      lbegin[i] = std::move(lcopy[i]);
     }
-
-    nsequences -= nmerges;
   }
 
   trace.exit_state("19:merge_local_sequences");
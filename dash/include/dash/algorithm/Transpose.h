@@ -0,0 +1,263 @@
+#ifndef DASH__ALGORITHM__TRANSPOSE_H__INCLUDED
+#define DASH__ALGORITHM__TRANSPOSE_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Types.h>
+#include <dash/Onesided.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/// Extent of the square tiles of the local cache-blocked transpose.
+constexpr int transpose_tile_extent = 32;
+
+/**
+ * Transposes a \c nrows x \c ncols section of local memory with the given
+ * row pointers into \c dst, a contiguous row-major \c ncols x \c nrows
+ * buffer. Elements are traversed in square tiles so that both source and
+ * destination lines stay in cache.
+ */
+template <typename ValueType, typename SizeType>
+void transpose_local(
+  /// Pointers to the first element of every source row
+  const std::vector<const ValueType *> & src_rows,
+  /// Number of source columns
+  SizeType                               ncols,
+  /// Destination buffer with \c ncols rows of \c src_rows.size() elements
+  ValueType                            * dst)
+{
+  const SizeType nrows = src_rows.size();
+  const SizeType tile  = transpose_tile_extent;
+  for (SizeType r_tile = 0; r_tile < nrows; r_tile += tile) {
+    const SizeType r_end = std::min(r_tile + tile, nrows);
+    for (SizeType c_tile = 0; c_tile < ncols; c_tile += tile) {
+      const SizeType c_end = std::min(c_tile + tile, ncols);
+      for (SizeType c = c_tile; c < c_end; ++c) {
+        ValueType * dst_row = dst + c * nrows;
+        for (SizeType r = r_tile; r < r_end; ++r) {
+          dst_row[r] = src_rows[r][c];
+        }
+      }
+    }
+  }
+}
+
+} // namespace internal
+
+/**
+ * Transposes the two-dimensional matrix \c src into \c dst, so that
+ * <tt>dst[j][i] == src[i][j]</tt>.
+ *
+ * The extents of \c dst must be the transposed extents of \c src, the
+ * patterns of both matrices may differ, e.g. \c TILE(a,b) and
+ * \c TILE(b,a). Every unit intersects its local blocks of \c src with the
+ * transposed blocks of \c dst, transposes every intersection with a local
+ * cache-blocked transpose and moves it to its owner in a single exchange of
+ * one-sided puts, one per section that is contiguous in the local memory of
+ * the owner. Sections owned by the calling unit are copied locally.
+ *
+ * Collective operation, returns once \c dst is complete at all units.
+ *
+ * \tparam  MatrixTypeSrc  two-dimensional \c dash::Matrix type with
+ *                         row-major storage order, e.g. with
+ *                         \c BlockPattern or \c TilePattern
+ * \tparam  MatrixTypeDst  two-dimensional \c dash::Matrix type with
+ *                         row-major storage order
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename MatrixTypeSrc,
+  typename MatrixTypeDst >
+void transpose(
+  /// Matrix to transpose, extents n x m
+  const MatrixTypeSrc & src,
+  /// Matrix to contain the transposed matrix, extents m x n
+  MatrixTypeDst       & dst)
+{
+  typedef typename MatrixTypeSrc::value_type     value_type;
+  typedef typename MatrixTypeSrc::pattern_type   pattern_src_t;
+  typedef typename MatrixTypeDst::pattern_type   pattern_dst_t;
+  typedef typename pattern_src_t::index_type     index_t;
+  typedef typename pattern_dst_t::index_type     dst_index_t;
+  typedef typename pattern_src_t::size_type      extent_t;
+
+  static_assert(
+    pattern_src_t::ndim() == 2 && pattern_dst_t::ndim() == 2,
+    "dash::transpose expects two-dimensional matrices");
+  static_assert(
+    pattern_src_t::memory_order() == ROW_MAJOR &&
+    pattern_dst_t::memory_order() == ROW_MAJOR,
+    "dash::transpose expects matrices in row-major storage order");
+
+  DASH_LOG_DEBUG("dash::transpose()");
+
+  const auto & pattern_src = src.pattern();
+  const auto & pattern_dst = dst.pattern();
+  if (pattern_src.extent(0) != pattern_dst.extent(1) ||
+      pattern_src.extent(1) != pattern_dst.extent(0)) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::transpose(): "
+      "extents of destination matrix are not the transposed extents of "
+      "the source matrix");
+  }
+
+  auto myid = pattern_dst.team().myid();
+  // Every local element of src is packed once, the buffer must remain
+  // valid until all puts completed:
+  std::vector<value_type>          buf(pattern_src.local_size());
+  std::vector<dart_handle_t>       handles;
+  std::vector<const value_type *>  src_rows;
+  value_type                     * buf_pos = buf.data();
+
+  // Transposes the section of src with rows [r0,r1) and columns [c0,c1),
+  // which is contained in a single block of dst, and moves it to the
+  // owner:
+  auto transpose_section = [&](index_t r0, index_t r1,
+                               index_t c0, index_t c1) {
+    extent_t nrows = r1 - r0;
+    extent_t ncols = c1 - c0;
+    src_rows.resize(nrows);
+    for (index_t r = r0; r < r1; ++r) {
+      src_rows[r - r0] = src.lbegin() +
+                         pattern_src.local_index({{ r, c0 }}).index;
+    }
+    dash::internal::transpose_local(src_rows, ncols, buf_pos);
+
+    // Rows of the transposed section in dst, merged while they are
+    // contiguous in the owner's local memory:
+    auto l_first = pattern_dst.local_index(
+                     {{ static_cast<dst_index_t>(c0),
+                        static_cast<dst_index_t>(r0) }});
+    auto unit    = l_first.unit;
+    dst_index_t run_dst_row = c0;
+    dst_index_t run_lidx    = l_first.index;
+    extent_t    run_size    = 0;
+    auto put_run = [&]() {
+      if (run_size == 0) {
+        return;
+      }
+      const value_type * run_buf = buf_pos + (run_dst_row - c0) * nrows;
+      if (unit == myid) {
+        std::copy(run_buf, run_buf + run_size, dst.lbegin() + run_lidx);
+      } else {
+        std::array<dst_index_t, 2> run_coords {{
+          run_dst_row, static_cast<dst_index_t>(r0) }};
+        auto gidx = pattern_dst.memory_layout().at(run_coords);
+        dart_handle_t handle;
+        dash::internal::put_handle(
+          (dst.begin() + gidx).dart_gptr(), run_buf, run_size, &handle);
+        if (handle != DART_HANDLE_NULL) {
+          handles.push_back(handle);
+        }
+      }
+    };
+    for (dst_index_t row = c0; row < static_cast<dst_index_t>(c1); ++row) {
+      auto lidx = (row == static_cast<dst_index_t>(c0))
+                  ? l_first.index
+                  : pattern_dst.local_index(
+                      {{ row, static_cast<dst_index_t>(r0) }}).index;
+      if (run_size > 0 && lidx == run_lidx + static_cast<dst_index_t>(
+                                               run_size)) {
+        run_size += nrows;
+        continue;
+      }
+      put_run();
+      run_dst_row = row;
+      run_lidx    = lidx;
+      run_size    = nrows;
+    }
+    put_run();
+    buf_pos += nrows * ncols;
+  };
+
+  auto nlblocks = pattern_src.local_blockspec().size();
+  for (decltype(nlblocks) lb = 0; lb < nlblocks; ++lb) {
+    // Extents of underfilled local blocks are not reduced by every pattern
+    // type, clip them to the matrix extents:
+    auto block = pattern_src.local_block(lb);
+    index_t r_begin = block.offset(0);
+    index_t r_end   = std::min<index_t>(r_begin + block.extent(0),
+                                        pattern_src.extent(0));
+    index_t c_begin = block.offset(1);
+    index_t c_end   = std::min<index_t>(c_begin + block.extent(1),
+                                        pattern_src.extent(1));
+    DASH_LOG_TRACE("dash::transpose", "local block", lb,
+                   "rows:", r_begin, r_end, "cols:", c_begin, c_end);
+    // Split the transposed block at the block borders of dst: columns of
+    // src are rows of dst and vice versa.
+    for (index_t c = c_begin; c < c_end; ) {
+      auto    dst_block_r = pattern_dst.block(
+                              pattern_dst.block_at(
+                                {{ static_cast<dst_index_t>(c),
+                                   static_cast<dst_index_t>(r_begin) }}));
+      index_t c_next      = std::min<index_t>(
+                              c_end,
+                              dst_block_r.offset(0) + dst_block_r.extent(0));
+      for (index_t r = r_begin; r < r_end; ) {
+        auto    dst_block = pattern_dst.block(
+                              pattern_dst.block_at(
+                                {{ static_cast<dst_index_t>(c),
+                                   static_cast<dst_index_t>(r) }}));
+        index_t r_next    = std::min<index_t>(
+                              r_end,
+                              dst_block.offset(1) + dst_block.extent(1));
+        transpose_section(r, r_next, c, c_next);
+        r = r_next;
+      }
+      c = c_next;
+    }
+  }
+
+  if (!handles.empty()) {
+    DASH_LOG_TRACE("dash::transpose", "waiting for transfers,",
+                   "num_handles:", handles.size());
+    dart_waitall(handles.data(), handles.size());
+  }
+  pattern_dst.team().barrier();
+  DASH_LOG_DEBUG("dash::transpose >");
+}
+
+/**
+ * Transposes the square two-dimensional matrix \c matrix, keeping its
+ * pattern.
+ *
+ * The matrix is transposed into a matrix with the same pattern (see
+ * \c dash::transpose(src, dst)) which then replaces the memory of
+ * \c matrix. Invalidates all iterators, references and views of the
+ * matrix.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <typename MatrixType>
+void transpose(
+  /// Matrix to transpose, extents n x n
+  MatrixType & matrix)
+{
+  if (matrix.extent(0) != matrix.extent(1)) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::transpose(): in-place transpose requires a square matrix");
+  }
+  MatrixType transposed(matrix.pattern());
+  dash::transpose(matrix, transposed);
+  matrix = std::move(transposed);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__TRANSPOSE_H__INCLUDED
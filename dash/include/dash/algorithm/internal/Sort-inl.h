@@ -12,8 +12,11 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <limits>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <dash/Array.h>
@@ -67,6 +70,32 @@ public:
   }
 };
 
+/**
+ * Midpoint of the splitter bounds [lower, upper], computed in unsigned
+ * arithmetic for integral bounds, as their difference overflows for keys
+ * spanning more than half of the value range.
+ */
+template <typename T>
+inline typename std::enable_if<
+    std::is_integral<T>::value && !std::is_same<T, bool>::value,
+    T>::type
+psort__midpoint(T lower, T upper)
+{
+  using unsigned_t = typename std::make_unsigned<T>::type;
+  return static_cast<T>(
+      static_cast<unsigned_t>(lower) +
+      (static_cast<unsigned_t>(upper) - static_cast<unsigned_t>(lower)) / 2);
+}
+
+template <typename T>
+inline typename std::enable_if<
+    !std::is_integral<T>::value || std::is_same<T, bool>::value,
+    T>::type
+psort__midpoint(T lower, T upper)
+{
+  return lower + (upper / 2 - lower / 2);
+}
+
 template <typename T>
 inline void psort__calc_boundaries(
     PartitionBorder<T>& p_borders, std::vector<T>& splitters)
@@ -93,9 +122,8 @@ inline void psort__calc_boundaries(
     else {
       // case C: ordinary iteration
 
-      splitters[idx] =
-          p_borders.lower_bound[idx] +
-          ((p_borders.upper_bound[idx] - p_borders.lower_bound[idx]) / 2);
+      splitters[idx] = psort__midpoint(
+          p_borders.lower_bound[idx], p_borders.upper_bound[idx]);
 
       if (splitters[idx] == p_borders.lower_bound[idx]) {
         // if we cannot move the partition to the left
@@ -658,6 +686,238 @@ inline auto find_global_min_max(
   return std::make_pair(std::get<0>(min_max_out), std::get<1>(min_max_out));
 }
 
+/**
+ * Merges k sorted runs with a tournament tree of losers: every inner node
+ * stores the run that lost the comparison at this node, so replacing the
+ * winner only requires log(k) comparisons along its path to the root.
+ * Exhausted runs lose every comparison, ties are broken by the run index.
+ */
+template <class RandomIt, class Compare>
+class LoserTree {
+  using run_t = std::pair<RandomIt, RandomIt>;
+
+public:
+  LoserTree(std::vector<run_t>& runs, Compare comp)
+    : m_runs(runs)
+    , m_comp(comp)
+    , m_nleaves(1)
+  {
+    while (m_nleaves < m_runs.size()) {
+      m_nleaves <<= 1;
+    }
+    m_tree.resize(m_nleaves);
+    std::vector<std::size_t> winners(2 * m_nleaves);
+    for (std::size_t leaf = 0; leaf < m_nleaves; ++leaf) {
+      winners[m_nleaves + leaf] = leaf;
+    }
+    for (std::size_t node = m_nleaves - 1; node > 0; --node) {
+      auto const left  = winners[2 * node];
+      auto const right = winners[2 * node + 1];
+      if (beats(left, right)) {
+        winners[node] = left;
+        m_tree[node]  = right;
+      }
+      else {
+        winners[node] = right;
+        m_tree[node]  = left;
+      }
+    }
+    m_tree[0] = winners[1];
+  }
+
+  /**
+   * Moves the \c n smallest remaining elements of all runs to \c out.
+   */
+  template <class OutputIt>
+  OutputIt merge(std::size_t n, OutputIt out)
+  {
+    for (std::size_t i = 0; i < n; ++i, ++out) {
+      auto winner = m_tree[0];
+      *out        = std::move(*m_runs[winner].first);
+      ++m_runs[winner].first;
+      // replay the matches on the path of the winner's leaf to the root
+      for (std::size_t node = (m_nleaves + winner) >> 1; node > 0;
+           node >>= 1) {
+        if (beats(m_tree[node], winner)) {
+          std::swap(m_tree[node], winner);
+        }
+      }
+      m_tree[0] = winner;
+    }
+    return out;
+  }
+
+private:
+  bool exhausted(std::size_t run) const
+  {
+    return run >= m_runs.size() || m_runs[run].first == m_runs[run].second;
+  }
+
+  bool beats(std::size_t a, std::size_t b) const
+  {
+    if (exhausted(a)) {
+      return false;
+    }
+    if (exhausted(b)) {
+      return true;
+    }
+    if (m_comp(*m_runs[b].first, *m_runs[a].first)) {
+      return false;
+    }
+    if (m_comp(*m_runs[a].first, *m_runs[b].first)) {
+      return true;
+    }
+    return a < b;
+  }
+
+private:
+  std::vector<run_t>&      m_runs;
+  Compare                  m_comp;
+  std::size_t              m_nleaves;
+  std::vector<std::size_t> m_tree;
+};
+
+/**
+ * Merges the sorted runs into the range beginning at \c out in a single
+ * k-way merge.
+ *
+ * With \c nthreads > 1, the output is split into \c nthreads partitions at
+ * splitters sampled from the runs, which are merged independently by
+ * \c nthreads OpenMP threads.
+ */
+template <class RandomIt, class OutputIt, class Compare>
+inline void psort__merge_runs(
+    std::vector<std::pair<RandomIt, RandomIt>> runs,
+    OutputIt                                   out,
+    Compare                                    comp,
+    int                                        nthreads)
+{
+  using run_t   = std::pair<RandomIt, RandomIt>;
+  using value_t = typename std::iterator_traits<RandomIt>::value_type;
+
+  std::size_t n = 0;
+  for (auto const& run : runs) {
+    n += std::distance(run.first, run.second);
+  }
+
+  if (nthreads <= 1 || runs.size() < 2) {
+    LoserTree<RandomIt, Compare> tree(runs, comp);
+    tree.merge(n, out);
+    return;
+  }
+
+  // Sample every run at evenly spaced positions and select the splitters
+  // of the partitions from the sorted samples:
+  std::size_t const    nsamples_run = 4 * nthreads;
+  std::vector<value_t> samples;
+  samples.reserve(nsamples_run * runs.size());
+  for (auto const& run : runs) {
+    auto const len = std::distance(run.first, run.second);
+    if (len == 0) {
+      continue;
+    }
+    for (std::size_t s = 1; s <= nsamples_run; ++s) {
+      samples.push_back(*std::next(run.first, len * s / (nsamples_run + 1)));
+    }
+  }
+  std::sort(samples.begin(), samples.end(), comp);
+
+  // Borders of the partitions in every run, partition p contains the
+  // elements in [borders[p][r], borders[p+1][r]) of every run r:
+  std::size_t const               nparts = nthreads;
+  std::vector<std::vector<RandomIt>> borders(
+      nparts + 1, std::vector<RandomIt>(runs.size()));
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    borders[0][r]      = runs[r].first;
+    borders[nparts][r] = runs[r].second;
+    for (std::size_t p = 1; p < nparts; ++p) {
+      auto const& splitter = samples[samples.size() * p / nparts];
+      borders[p][r]        = std::lower_bound(
+          borders[p - 1][r], runs[r].second, splitter, comp);
+    }
+  }
+  std::vector<std::size_t> out_offsets(nparts + 1, 0);
+  for (std::size_t p = 0; p < nparts; ++p) {
+    out_offsets[p + 1] = out_offsets[p];
+    for (std::size_t r = 0; r < runs.size(); ++r) {
+      out_offsets[p + 1] += std::distance(borders[p][r], borders[p + 1][r]);
+    }
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 1)
+#endif
+  for (std::size_t p = 0; p < nparts; ++p) {
+    std::vector<run_t> part_runs(runs.size());
+    for (std::size_t r = 0; r < runs.size(); ++r) {
+      part_runs[r] = std::make_pair(borders[p][r], borders[p + 1][r]);
+    }
+    LoserTree<RandomIt, Compare> tree(part_runs, comp);
+    tree.merge(
+        out_offsets[p + 1] - out_offsets[p], std::next(out, out_offsets[p]));
+  }
+}
+
+/**
+ * Sorts the local range [first, last). With \c nthreads > 1, equally sized
+ * chunks are sorted by \c nthreads OpenMP threads and then merged with
+ * \c psort__merge_runs.
+ */
+template <class RandomIt, class Compare>
+inline void psort__local_sort(
+    RandomIt first, RandomIt last, Compare comp, int nthreads)
+{
+  using value_t = typename std::iterator_traits<RandomIt>::value_type;
+
+  auto const n = std::distance(first, last);
+  if (nthreads <= 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+
+  std::vector<std::pair<RandomIt, RandomIt>> chunks(nthreads);
+  for (int t = 0; t < nthreads; ++t) {
+    chunks[t] = std::make_pair(
+        std::next(first, n * t / nthreads),
+        std::next(first, n * (t + 1) / nthreads));
+  }
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    std::sort(chunks[t].first, chunks[t].second, comp);
+  }
+
+  std::vector<value_t> buf(n);
+  psort__merge_runs(chunks, buf.begin(), comp, nthreads);
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    first[i] = std::move(buf[i]);
+  }
+}
+
+/**
+ * Number of threads used in the local phases of dash::sort for a local
+ * range of \c n elements, at least 1. Small ranges are sorted by a single
+ * thread.
+ */
+inline int psort__num_threads(std::size_t n)
+{
+#ifdef DASH_ENABLE_OPENMP
+  constexpr std::size_t min_elements_per_thread = 1 << 14;
+  dash::util::UnitLocality uloc;
+  auto const n_threads = std::min<std::size_t>(
+      uloc.num_domain_threads(), n / min_elements_per_thread);
+  return std::max<int>(n_threads, 1);
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
 #ifdef DASH_ENABLE_TRACE_LOGGING
 
 template <
@@ -0,0 +1,97 @@
+#ifndef DASH__ALGORITHM__INTERNAL__UNIT_RANGE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__UNIT_RANGE_H__INCLUDED
+
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/LocalRange.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <numeric>
+#include <vector>
+
+
+namespace dash {
+namespace detail {
+
+/**
+ * Local elements of a unit in a range of a one-dimensional container and
+ * the offsets of the local elements of all units in the range. Positions in
+ * the range are ordered by unit, as in \c dash::sort.
+ */
+template <typename ValueType>
+struct unit_range {
+  ValueType                * lbegin;
+  std::size_t                nlocal;
+  /// Offsets of the local elements of all units, the last element is the
+  /// size of the range
+  std::vector<std::size_t>   unit_offsets;
+};
+
+/**
+ * Local elements of the calling unit in the range \c [first, last) and
+ * offsets of the local elements of all units.
+ *
+ * Collective operation.
+ */
+template <class GlobRandomIt>
+unit_range<typename GlobRandomIt::value_type>
+unit_range_of(GlobRandomIt first, GlobRandomIt last)
+{
+  auto & team    = first.pattern().team();
+  auto   l_range = dash::local_index_range(first, last);
+  auto * l_mem   = dash::local_begin(
+                     static_cast<typename GlobRandomIt::pointer>(first),
+                     team.myid());
+
+  unit_range<typename GlobRandomIt::value_type> range;
+  range.lbegin = l_mem + l_range.begin;
+  range.nlocal = l_range.end - l_range.begin;
+  range.unit_offsets.assign(team.size() + 1, 0);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &range.nlocal, range.unit_offsets.data() + 1, 1,
+      dash::dart_datatype<std::size_t>::value, team.dart_id()),
+    DART_OK);
+  std::partial_sum(
+    range.unit_offsets.begin(), range.unit_offsets.end(),
+    range.unit_offsets.begin());
+  return range;
+}
+
+/**
+ * Gathers the local vectors of all units at every unit, ordered by unit.
+ *
+ * Collective operation.
+ */
+template <typename T>
+std::vector<T> allgather_vectors(
+  dash::Team           & team,
+  const std::vector<T> & local)
+{
+  auto const          nunits = team.size();
+  std::size_t         nbytes = local.size() * sizeof(T);
+  std::vector<size_t> counts(nunits);
+  std::vector<size_t> displs(nunits, 0);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &nbytes, counts.data(), 1,
+      dash::dart_datatype<std::size_t>::value, team.dart_id()),
+    DART_OK);
+  std::partial_sum(counts.begin(), counts.end() - 1, displs.begin() + 1);
+  std::vector<T> all((displs.back() + counts.back()) / sizeof(T));
+  DASH_ASSERT_RETURNS(
+    dart_allgatherv(
+      local.data(), nbytes, DART_TYPE_BYTE, all.data(),
+      counts.data(), displs.data(), team.dart_id()),
+    DART_OK);
+  return all;
+}
+
+} // namespace detail
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__UNIT_RANGE_H__INCLUDED
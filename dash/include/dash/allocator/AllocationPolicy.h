@@ -9,6 +9,7 @@
 #include <dash/allocator/internal/Types.h>
 #include <dash/internal/Logging.h>
 #include <dash/memory/MemorySpaceBase.h>
+#include <dash/memory/HostSpace.h>
 
 std::ostream& operator<<(std::ostream& os, const dart_gptr_t& dartptr);
 
@@ -153,10 +154,11 @@ class GlobalAllocationPolicy<
 public:
   /// Variant to allocate symmetrically in global memory space if we
   /// allocate in the default Host Space. In this case DART can allocate
-  /// symmatrically.
+  /// symmatrically. The NUMA placement policy of the host space is applied
+  /// to the local portion of the allocation.
   dart_gptr_t allocate_segment(
       dart_team_t teamid,
-      LocalMemorySpaceBase<memory_space_tag>* /* res */,
+      LocalMemorySpaceBase<memory_space_tag>* res,
       std::size_t nbytes,
       std::size_t /*alignment*/)
   {
@@ -181,6 +183,18 @@ public:
       throw std::bad_alloc{};
     }
 
+    auto const* host_space = dynamic_cast<HostSpace const*>(res);
+    if (host_space != nullptr &&
+        host_space->policy() != numa_policy::first_touch) {
+      dart_team_unit_t myid;
+      void*            lbegin = nullptr;
+      dart_gptr_t      lgptr  = gptr;
+      DASH_ASSERT_RETURNS(dart_team_myid(teamid, &myid), DART_OK);
+      dart_gptr_setunit(&lgptr, myid);
+      DASH_ASSERT_RETURNS(dart_gptr_getaddr(lgptr, &lbegin), DART_OK);
+      host_space->place(lbegin, nbytes);
+    }
+
     return gptr;
   }
 
@@ -6,7 +6,10 @@
 #include <dash/internal/Logging.h>
 #include <dash/util/FunctionalExpr.h>
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <vector>
 
 namespace dash {
 
@@ -300,6 +303,108 @@ std::ostream& operator<<(
   return os;
 }
 
+/**
+ * Stencil specification for multiple time steps between two halo updates
+ * (deep halos).
+ *
+ * Contains all stencil points reachable by applying the given
+ * \ref StencilSpec \c num_steps times. A \ref HaloSpec built from it
+ * provides halo regions of up to \c num_steps times the stencil radius,
+ * which allows \ref StencilOperator::update_steps to perform \c num_steps
+ * time steps per halo update.
+ *
+ * e.g. MultiStepStencilSpec<StencilSpec_t>(stencil_spec, 3)
+ */
+template <typename StencilSpecT>
+class MultiStepStencilSpec {
+private:
+  using StencilPoint_t = typename StencilSpecT::StencilPoint_t;
+
+  static constexpr auto NumDimensions = StencilPoint_t::ndim();
+
+public:
+  using stencil_size_t = typename StencilSpecT::stencil_size_t;
+  using StencilArray_t = std::vector<StencilPoint_t>;
+
+public:
+  /**
+   * Constructor
+   *
+   * Takes the \ref StencilSpec applied in every time step and the number of
+   * time steps between two halo updates.
+   */
+  MultiStepStencilSpec(const StencilSpecT& stencil_spec,
+                       std::size_t         num_steps)
+  : _stencil_spec(stencil_spec), _num_steps(num_steps) {
+    DASH_ASSERT_GT(num_steps, 0, "At least one time step required");
+
+    auto less = [](const StencilPoint_t& lhs, const StencilPoint_t& rhs) {
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        if(lhs[d] != rhs[d])
+          return lhs[d] < rhs[d];
+      }
+      return false;
+    };
+    auto equal = [](const StencilPoint_t& lhs, const StencilPoint_t& rhs) {
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        if(lhs[d] != rhs[d])
+          return false;
+      }
+      return true;
+    };
+
+    // the center is part of every time step
+    StencilArray_t points(1);
+    for(std::size_t step = 0; step < num_steps; ++step) {
+      StencilArray_t next(points);
+      for(const auto& point : points) {
+        for(const auto& stencil_point : stencil_spec.specs()) {
+          auto point_next = point;
+          for(dim_t d = 0; d < NumDimensions; ++d)
+            point_next[d] += stencil_point[d];
+          next.push_back(point_next);
+        }
+      }
+      std::sort(next.begin(), next.end(), less);
+      next.erase(std::unique(next.begin(), next.end(), equal), next.end());
+      points = std::move(next);
+    }
+
+    const StencilPoint_t center;
+    std::copy_if(points.begin(), points.end(), std::back_inserter(_specs),
+                 [&](const StencilPoint_t& point) {
+                   return !equal(point, center);
+                 });
+  }
+
+  /**
+   * \return container storing all stencil points reachable within the
+   *         given number of time steps
+   */
+  const StencilArray_t& specs() const { return _specs; }
+
+  /**
+   * \return number of stencil points reachable within the given number of
+   *         time steps
+   */
+  stencil_size_t num_stencil_points() const { return _specs.size(); }
+
+  /**
+   * \return the \ref StencilSpec applied in every time step
+   */
+  const StencilSpecT& stencil_spec() const { return _stencil_spec; }
+
+  /**
+   * \return number of time steps between two halo updates
+   */
+  std::size_t num_steps() const { return _num_steps; }
+
+private:
+  StencilSpecT   _stencil_spec;
+  std::size_t    _num_steps;
+  StencilArray_t _specs;
+};  // MultiStepStencilSpec
+
 /**
  * Global boundary Halo properties
  */
@@ -1385,7 +1490,7 @@ public:
         if(check_extent > _pattern.extent(d)) {
           safe_extent -= check_extent - _pattern.extent(d);
         } else {
-          bnd_elem_offsets[d] += view_extent - _halo_extents_max[d].first;
+          bnd_elem_offsets[d] = view_extent - _halo_extents_max[d].second;
           bnd_elem_extents[d] = _halo_extents_max[d].second;
           push_bnd_elems(d, bnd_elem_offsets, bnd_elem_extents,
                          _halo_extents_max, bound_spec);
@@ -1396,7 +1501,7 @@ public:
         bnd_elem_offsets[d] -= global_offset;
         push_bnd_elems(d, bnd_elem_offsets, bnd_elem_extents, _halo_extents_max,
                        bound_spec);
-        bnd_elem_offsets[d] += view_extent - _halo_extents_max[d].first;
+        bnd_elem_offsets[d] = view_extent - _halo_extents_max[d].second;
         bnd_elem_extents[d] = _halo_extents_max[d].second;
         push_bnd_elems(d, bnd_elem_offsets, bnd_elem_extents, _halo_extents_max,
                        bound_spec);
@@ -1723,6 +1828,13 @@ public:
    */
   const_iterator end() const { return _halobuffer.end(); }
 
+  /**
+   * Container storing all halo elements
+   *
+   * \return Reference to the container storing all halo elements
+   */
+  HaloBuffer_t& buffer() { return _halobuffer; }
+
   /**
    * Container storing all halo elements
    *
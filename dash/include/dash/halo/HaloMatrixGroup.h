@@ -0,0 +1,308 @@
+#ifndef DASH__HALO_HALOMATRIXGROUP_H
+#define DASH__HALO_HALOMATRIXGROUP_H
+
+#include <dash/halo/HaloMatrixWrapper.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dash {
+
+namespace halo {
+
+/**
+ * Exchanges the halo regions of several matrices with the same pattern
+ * together, e.g. the fields of a multi-physics code.
+ *
+ * Every field has its own \ref HaloMatrixWrapper providing the halo memory
+ * and the stencil operators, but the halo regions of all fields are
+ * updated with a single transfer per neighbor and region: every unit packs
+ * the boundaries requested by a neighbor for all fields into one
+ * contiguous section of a send buffer, which is fetched and unpacked into
+ * the halo memory of every field by the neighbor.
+ *
+ * The send buffer is double-buffered, so an update only requires a single
+ * barrier between packing and fetching: a unit packing the next update
+ * passed the barrier of the current one, which every neighbor only enters
+ * after waiting for the previous update.
+ */
+template <typename MatrixT>
+class HaloMatrixGroup {
+private:
+  using Pattern_t       = typename MatrixT::pattern_type;
+  using pattern_index_t = typename Pattern_t::index_type;
+  using pattern_size_t  = typename Pattern_t::size_type;
+  using GlobMem_t       = typename MatrixT::GlobMem_t;
+
+  static constexpr auto NumDimensions = Pattern_t::ndim();
+  static constexpr auto MaxIndex = RegionCoords<NumDimensions>::MaxIndex;
+
+public:
+  using HaloWrapper_t   = HaloMatrixWrapper<MatrixT>;
+  using Element_t       = typename HaloWrapper_t::Element_t;
+  using GlobBoundSpec_t = typename HaloWrapper_t::GlobBoundSpec_t;
+  using ViewSpec_t      = typename HaloWrapper_t::ViewSpec_t;
+  using region_index_t  = typename HaloWrapper_t::region_index_t;
+
+private:
+  using Region_t = Region<Element_t, Pattern_t, GlobMem_t>;
+
+  /*
+   * Contiguous run of boundary elements in local memory.
+   */
+  struct Run {
+    pattern_index_t offset;
+    pattern_size_t  size;
+  };
+
+  /*
+   * Boundary elements requested by a neighbor for its halo region. The
+   * section at the given offset of the send buffer holds both halves of
+   * the double buffer with the elements of all fields each.
+   */
+  struct SendSection {
+    pattern_size_t   offset;
+    pattern_size_t   size;
+    std::vector<Run> runs;
+  };
+
+  /*
+   * Halo region of all fields fetched from the neighbor's send buffer.
+   */
+  struct RecvSection {
+    region_index_t index;
+    dart_gptr_t    gptr;
+    pattern_size_t offset;
+    pattern_size_t size;
+    dart_handle_t  handle = DART_HANDLE_NULL;
+  };
+
+  /*
+   * Section published by every unit for each halo region index, read by
+   * the neighbors once.
+   */
+  struct Section {
+    int64_t offset;
+    int64_t size;
+  };
+
+public:
+  /**
+   * Constructor that takes the matrices, a \ref GlobalBoundarySpec and a
+   * user defined number of stencil specifications (\ref StencilSpec) used
+   * for all fields. All matrices must have the same pattern.
+   *
+   * The constructor is collective.
+   */
+  template <typename... StencilSpecT>
+  HaloMatrixGroup(const std::vector<MatrixT*>& matrices,
+                  const GlobBoundSpec_t&        bound_spec,
+                  const StencilSpecT&... stencil_spec) {
+    DASH_ASSERT_MSG(!matrices.empty(), "No matrix given for halo group");
+    _fields.reserve(matrices.size());
+    for(auto* matrix : matrices) {
+      DASH_ASSERT_MSG(matrix->pattern() == matrices.front()->pattern(),
+                      "Matrices of a halo group must have the same pattern");
+      _fields.emplace_back(
+        new HaloWrapper_t(*matrix, bound_spec, stencil_spec...));
+    }
+    init(bound_spec);
+  }
+
+  HaloMatrixGroup(const HaloMatrixGroup&) = delete;
+  HaloMatrixGroup& operator=(const HaloMatrixGroup&) = delete;
+
+  ~HaloMatrixGroup() {
+    dart_team_memderegister(_send_gptr);
+    dart_team_memfree(_section_gptr);
+  }
+
+  /**
+   * Returns the number of fields
+   */
+  std::size_t size() const { return _fields.size(); }
+
+  /**
+   * Returns the \ref HaloMatrixWrapper of the given field
+   */
+  HaloWrapper_t& field(std::size_t pos) { return *_fields[pos]; }
+
+  /**
+   * Returns the \ref HaloMatrixWrapper of the given field
+   */
+  HaloWrapper_t& operator[](std::size_t pos) { return *_fields[pos]; }
+
+  /**
+   * Initiates a blocking halo region update for all fields.
+   */
+  void update() {
+    update_async();
+    wait();
+  }
+
+  /**
+   * Initiates an asychronous halo region update for all fields.
+   *
+   * Packs the boundaries of all fields and starts fetching the halo regions
+   * once all units packed their boundaries. This is collective.
+   */
+  void update_async() {
+    _generation ^= 1;
+    auto num_fields = _fields.size();
+    for(const auto& section : _send_sections) {
+      auto* out = _send_buffer.data() + section.offset
+                  + _generation * section.size * num_fields;
+      for(const auto& field : _fields) {
+        const auto* lmem = field->matrix().lbegin();
+        for(const auto& run : section.runs)
+          out = std::copy(lmem + run.offset, lmem + run.offset + run.size,
+                          out);
+      }
+    }
+    _team->barrier();
+
+    for(auto& section : _recv_sections) {
+      auto gptr = section.gptr;
+      dart_gptr_incaddr(&gptr, _generation * section.size * num_fields
+                                 * sizeof(Element_t));
+      auto ds = dart_storage<Element_t>(section.size * num_fields);
+      dart_get_handle(_recv_buffer.data() + section.offset * num_fields, gptr,
+                      ds.nelem, ds.dtype, ds.dtype, &section.handle);
+    }
+  }
+
+  /**
+   * Waits until the halo updates of all fields are finished and unpacks
+   * the halo regions. Only useful for asynchronous halo updates.
+   */
+  void wait() {
+    auto num_fields = _fields.size();
+    for(auto& section : _recv_sections) {
+      dart_wait_local(&section.handle);
+      const auto* in = _recv_buffer.data() + section.offset * num_fields;
+      for(auto& field : _fields) {
+        auto* halo_mem =
+          &*(field->halo_memory().first_element_at(section.index));
+        std::copy(in, in + section.size, halo_mem);
+        in += section.size;
+      }
+    }
+  }
+
+private:
+  /*
+   * Sets up the send sections for all neighbors, publishes their layout and
+   * reads the layout of the sections fetched from the neighbors.
+   */
+  void init(const GlobBoundSpec_t& bound_spec) {
+    auto&       matrix  = _fields.front()->matrix();
+    const auto& pattern = matrix.pattern();
+    auto        myid    = matrix.team().myid();
+    auto        num_fields = _fields.size();
+    ViewSpec_t  view_global(matrix.local.offsets(), matrix.local.extents());
+    const auto& halo_spec = _fields.front()->halo_block().halo_spec();
+
+    _team = &matrix.team();
+
+    std::array<Section, MaxIndex> sections;
+    sections.fill(Section{ -1, 0 });
+    for(const auto& spec : halo_spec.specs()) {
+      ViewSpec_t  boundary_view;
+      team_unit_t target;
+      if(!internal::neighbor_halo_view(pattern, view_global, bound_spec, spec,
+                                       boundary_view, target))
+        continue;
+
+      Region_t region(spec, boundary_view, matrix.begin().globmem(), pattern,
+                      typename Region_t::Border_t{}, false);
+      SendSection section{ 2 * _send_size * num_fields, region.size(), {} };
+      for(auto it = region.begin(); it != region.end(); ++it) {
+        auto offset = it.lpos().index;
+        if(!section.runs.empty()
+           && section.runs.back().offset + section.runs.back().size
+                == static_cast<pattern_size_t>(offset))
+          ++section.runs.back().size;
+        else
+          section.runs.push_back(Run{ offset, 1 });
+      }
+      sections[spec.index()] =
+        Section{ static_cast<int64_t>(section.offset),
+                 static_cast<int64_t>(region.size()) };
+      _send_size += region.size();
+      _send_sections.push_back(std::move(section));
+    }
+    _send_buffer.resize(2 * _send_size * num_fields);
+
+    auto ds_send = dart_storage<Element_t>(_send_buffer.size());
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister(_team->dart_id(), ds_send.nelem, ds_send.dtype,
+                            _send_buffer.data(), &_send_gptr),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(_team->dart_id(), sizeof(Section) * MaxIndex,
+                                 DART_TYPE_BYTE, &_section_gptr),
+      DART_OK);
+    Section* sections_local = nullptr;
+    auto     gptr_local     = _section_gptr;
+    dart_gptr_setunit(&gptr_local, myid);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(gptr_local,
+                        reinterpret_cast<void**>(&sections_local)),
+      DART_OK);
+    std::copy(sections.begin(), sections.end(), sections_local);
+    _team->barrier();
+
+    pattern_size_t recv_size = 0;
+    for(const auto& region : _fields.front()->halo_block().halo_regions()) {
+      if(region.size() == 0 || region.is_custom_region())
+        continue;
+
+      team_unit_t source(region.begin().lpos().unit.id);
+      auto        gptr_section = _section_gptr;
+      dart_gptr_setunit(&gptr_section, source);
+      dart_gptr_incaddr(&gptr_section, region.index() * sizeof(Section));
+      Section section;
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(&section, gptr_section, sizeof(Section),
+                          DART_TYPE_BYTE, DART_TYPE_BYTE),
+        DART_OK);
+      DASH_ASSERT_MSG(section.offset >= 0
+                        && section.size
+                             == static_cast<int64_t>(region.size()),
+                      "Boundary section of the neighbor does not match the "
+                      "halo region");
+
+      auto gptr = _send_gptr;
+      dart_gptr_setunit(&gptr, source);
+      dart_gptr_incaddr(&gptr, section.offset * sizeof(Element_t));
+      _recv_sections.push_back(
+        RecvSection{ region.index(), gptr, recv_size, region.size() });
+      recv_size += region.size();
+    }
+    _recv_buffer.resize(recv_size * num_fields);
+    _team->barrier();
+  }
+
+private:
+  std::vector<std::unique_ptr<HaloWrapper_t>> _fields;
+  dash::Team*                                 _team = nullptr;
+  std::vector<SendSection>                    _send_sections;
+  std::vector<RecvSection>                    _recv_sections;
+  std::vector<Element_t>                      _send_buffer;
+  std::vector<Element_t>                      _recv_buffer;
+  // number of boundary elements packed per field
+  pattern_size_t                              _send_size    = 0;
+  dart_gptr_t                                 _send_gptr    = DART_GPTR_NULL;
+  dart_gptr_t                                 _section_gptr = DART_GPTR_NULL;
+  // half of the send buffer packed in the current update
+  pattern_size_t                              _generation   = 1;
+};
+
+}  // namespace halo
+
+}  // namespace dash
+
+#endif  // DASH__HALO_HALOMATRIXGROUP_H
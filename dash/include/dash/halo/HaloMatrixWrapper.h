@@ -7,6 +7,8 @@
 #include <dash/Pattern.h>
 #include <dash/halo/StencilOperator.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <vector>
 
@@ -14,6 +16,74 @@ namespace dash {
 
 namespace halo {
 
+/**
+ * Mode of the halo region updates of a \ref HaloMatrixWrapper.
+ */
+enum class HaloUpdateMode : uint8_t {
+  /// Every unit gets its halo regions from the boundaries of its neighbors.
+  /// Boundaries must not be modified before all neighbors finished their
+  /// update, which usually requires a barrier.
+  PULL,
+  /// Every unit puts its boundaries into the halo regions of its neighbors
+  /// and notifies them per region. Units only wait for their neighbors.
+  /// Boundaries consisting of many small blocks are packed into contiguous
+  /// buffers instead of being described by datatypes.
+  PUSH
+};
+
+namespace internal {
+
+/*
+ * Computes the boundary elements of the local block given by its global
+ * view that form the halo region with the given spec at the neighboring
+ * unit, which is the neighbor in the opposite direction of the spec.
+ * Returns false if the halo region is empty or there is no neighbor in
+ * the opposite direction.
+ */
+template <typename PatternT, typename ViewSpecT, typename GlobBoundSpecT,
+          typename RegionSpecT>
+bool neighbor_halo_view(const PatternT& pattern, const ViewSpecT& view_global,
+                        const GlobBoundSpecT& bound_spec,
+                        const RegionSpecT& spec, ViewSpecT& boundary_view,
+                        team_unit_t& target) {
+  using signed_index_t = typename std::make_signed<
+    typename PatternT::size_type>::type;
+
+  auto halo_extent = spec.extent();
+  if(!halo_extent)
+    return false;
+
+  auto offsets = view_global.offsets();
+  auto extents = view_global.extents();
+  std::array<typename PatternT::index_type, PatternT::ndim()> target_coords;
+  for(dim_t d = 0; d < PatternT::ndim(); ++d) {
+    signed_index_t coord = offsets[d];
+    if(spec[d] == 0) {
+      coord = offsets[d] + extents[d];
+      offsets[d] += extents[d] - halo_extent;
+      extents[d] = halo_extent;
+    } else if(spec[d] == 2) {
+      coord      = offsets[d] - 1;
+      extents[d] = halo_extent;
+    }
+
+    signed_index_t pattern_extent = pattern.extent(d);
+    if(coord < 0 || coord >= pattern_extent) {
+      if(bound_spec[d] != BoundaryProp::CYCLIC)
+        return false;
+
+      coord = (coord + pattern_extent) % pattern_extent;
+    }
+    target_coords[d] = coord;
+  }
+  boundary_view = ViewSpecT(offsets, extents);
+  target        = pattern.unit_at(target_coords);
+
+  return true;
+}
+
+}  // namespace internal
+
 /**
  * As known from classic stencil algorithms, *boundaries* are the outermost
  * elements within a block that are requested by neighoring units.
@@ -66,6 +136,9 @@ public:
 
 private:
   static constexpr auto MemoryArrange = Pattern_t::memory_order();
+  static constexpr auto MaxIndex = RegionCoords<NumDimensions>::MaxIndex;
+  // regions with smaller blocks are packed for push updates
+  static constexpr std::size_t PackBlockBytesMax = 256;
 
   using pattern_size_t        = typename Pattern_t::size_type;
   using signed_pattern_size_t = typename std::make_signed<pattern_size_t>::type;
@@ -80,7 +153,22 @@ public:
   template <typename... StencilSpecT>
   HaloMatrixWrapper(MatrixT& matrix, const GlobBoundSpec_t& cycle_spec,
                     const StencilSpecT&... stencil_spec)
-  : _matrix(matrix), _cycle_spec(cycle_spec), _halo_spec(stencil_spec...),
+  : HaloMatrixWrapper(matrix, HaloUpdateMode::PULL, cycle_spec,
+                      stencil_spec...) {}
+
+  /**
+   * Constructor that takes \ref Matrix, the \ref HaloUpdateMode, a
+   * \ref GlobalBoundarySpec and a user defined number of stencil
+   * specifications (\ref StencilSpec).
+   *
+   * The constructor is collective if \c mode is \c HaloUpdateMode::PUSH.
+   */
+  template <typename... StencilSpecT>
+  HaloMatrixWrapper(MatrixT& matrix, HaloUpdateMode mode,
+                    const GlobBoundSpec_t& cycle_spec,
+                    const StencilSpecT&... stencil_spec)
+  : _matrix(matrix), _mode(mode), _cycle_spec(cycle_spec),
+    _halo_spec(stencil_spec...),
     _view_global(matrix.local.offsets(), matrix.local.extents()),
     _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global,
                _halo_spec, cycle_spec),
@@ -88,153 +176,14 @@ public:
     for(const auto& region : _haloblock.halo_regions()) {
       if(region.size() == 0)
         continue;
-      // number of contiguous elements
-      pattern_size_t num_blocks      = 1;
-      pattern_size_t num_elems_block = 1;
-      auto           rel_dim         = region.spec().relevant_dim();
-      auto           level           = region.spec().level();
-      auto*          off = &*(_halomemory.first_element_at(region.index()));
-      auto           it  = region.begin();
-
-      if(MemoryArrange == ROW_MAJOR) {
-        if(level == 1) {  //|| (level == 2 && region.regionSpec()[0] != 1)) {
-          for(auto i = rel_dim - 1; i < NumDimensions; ++i)
-            num_elems_block *= region.view().extent(i);
-
-          size_t region_size        = region.size();
-          auto   ds_num_elems_block = dart_storage<Element_t>(num_elems_block);
-          num_blocks                = region_size / num_elems_block;
-          auto           it_dist    = it + num_elems_block;
-          pattern_size_t stride =
-            (num_blocks > 1) ? std::abs(it_dist.lpos().index - it.lpos().index)
-                             : 1;
-          auto            ds_stride = dart_storage<Element_t>(stride);
-          dart_datatype_t stride_type;
-          dart_type_create_strided(ds_num_elems_block.dtype, ds_stride.nelem,
-                                   ds_num_elems_block.nelem, &stride_type);
-          _dart_types.push_back(stride_type);
-
-          _region_data.insert(std::make_pair(
-            region.index(), Data{ region,
-                                  [off, it, region_size, ds_num_elems_block,
-                                   stride_type](dart_handle_t& handle) {
-                                    dart_get_handle(off, it.dart_gptr(),
-                                                    region_size, stride_type,
-                                                    ds_num_elems_block.dtype,
-                                                    &handle);
-                                  },
-                                  DART_HANDLE_NULL }));
-
-        }
-        // TODO more optimizations
-        else {
-          num_elems_block *= region.view().extent(NumDimensions - 1);
-          size_t region_size         = region.size();
-          auto   ds_num_elems_block  = dart_storage<Element_t>(num_elems_block);
-          num_blocks                 = region_size / num_elems_block;
-          auto                it_tmp = it;
-          auto                start_index = it.lpos().index;
-          std::vector<size_t> block_sizes(num_blocks);
-          std::vector<size_t> block_offsets(num_blocks);
-          std::fill(block_sizes.begin(), block_sizes.end(),
-                    ds_num_elems_block.nelem);
-          for(auto& index : block_offsets) {
-            index =
-              dart_storage<Element_t>(it_tmp.lpos().index - start_index).nelem;
-            it_tmp += num_elems_block;
-          }
-          dart_datatype_t index_type;
-          dart_type_create_indexed(
-            ds_num_elems_block.dtype,
-            num_blocks,            // number of blocks
-            block_sizes.data(),    // size of each block
-            block_offsets.data(),  // offset of first element of each block
-            &index_type);
-          _dart_types.push_back(index_type);
-          _region_data.insert(std::make_pair(
-            region.index(), Data{ region,
-                                  [off, it, ds_num_elems_block, region_size,
-                                   index_type](dart_handle_t& handle) {
-                                    dart_get_handle(off, it.dart_gptr(),
-                                                    region_size, index_type,
-                                                    ds_num_elems_block.dtype,
-                                                    &handle);
-                                  },
-                                  DART_HANDLE_NULL }));
-        }
-      } else {
-        if(level == 1) {  //|| (level == 2 &&
-                          // region.regionSpec()[NumDimensions - 1] != 1)) {
-          for(auto i = 0; i < rel_dim; ++i)
-            num_elems_block *= region.view().extent(i);
-
-          size_t region_size        = region.size();
-          auto   ds_num_elems_block = dart_storage<Element_t>(num_elems_block);
-          num_blocks                = region_size / num_elems_block;
-          auto           it_dist    = it + num_elems_block;
-          pattern_size_t stride =
-            (num_blocks > 1) ? std::abs(it_dist.lpos().index - it.lpos().index)
-                             : 1;
-          auto ds_stride = dart_storage<Element_t>(stride);
-
-          dart_datatype_t stride_type;
-          dart_type_create_strided(ds_num_elems_block.dtype, ds_stride.nelem,
-                                   ds_num_elems_block.nelem, &stride_type);
-          _dart_types.push_back(stride_type);
-
-          _region_data.insert(std::make_pair(
-            region.index(), Data{ region,
-                                  [off, it, region_size, ds_num_elems_block,
-                                   stride_type](dart_handle_t& handle) {
-                                    dart_get_handle(off, it.dart_gptr(),
-                                                    region_size, stride_type,
-                                                    ds_num_elems_block.dtype,
-                                                    &handle);
-                                  },
-                                  DART_HANDLE_NULL }));
-        }
-        // TODO more optimizations
-        else {
-          num_elems_block *= region.view().extent(0);
-          size_t region_size         = region.size();
-          auto   ds_num_elems_block  = dart_storage<Element_t>(num_elems_block);
-          num_blocks                 = region_size / num_elems_block;
-          auto                it_tmp = it;
-          std::vector<size_t> block_sizes(num_blocks);
-          std::vector<size_t> block_offsets(num_blocks);
-          std::fill(block_sizes.begin(), block_sizes.end(),
-                    ds_num_elems_block.nelem);
-          auto start_index = it.lpos().index;
-          for(auto& index : block_offsets) {
-            index =
-              dart_storage<Element_t>(it_tmp.lpos().index - start_index).nelem;
-            it_tmp += num_elems_block;
-          }
-
-          dart_datatype_t index_type;
-          dart_type_create_indexed(
-            ds_num_elems_block.dtype,
-            num_blocks,            // number of blocks
-            block_sizes.data(),    // size of each block
-            block_offsets.data(),  // offset of first element of each block
-            &index_type);
-          _dart_types.push_back(index_type);
-
-          _region_data.insert(std::make_pair(
-            region.index(), Data{ region,
-                                  [off, it, index_type, region_size,
-                                   ds_num_elems_block](dart_handle_t& handle) {
-                                    dart_get_handle(off, it.dart_gptr(),
-                                                    region_size, index_type,
-                                                    ds_num_elems_block.dtype,
-                                                    &handle);
-                                  },
-                                  DART_HANDLE_NULL }));
-        }
 
-        num_elems_block = region.view().extent(0);
-      }
+      auto* off = &*(_halomemory.first_element_at(region.index()));
+      _region_data.insert(std::make_pair(
+        region.index(), Data(region, off, region_datatype(region))));
     }
+
+    if(_mode == HaloUpdateMode::PUSH)
+      init_push();
   }
 
   /**
@@ -249,6 +198,10 @@ public:
   HaloMatrixWrapper() = delete;
 
   ~HaloMatrixWrapper() {
+    if(_mode == HaloUpdateMode::PUSH) {
+      dart_team_memderegister(_halo_gptr);
+      dart_team_memfree(_signal_gptr);
+    }
     for(auto& dart_type : _dart_types) {
       dart_type_destroy(&dart_type);
     }
@@ -260,13 +213,16 @@ public:
    */
   const HaloBlock_t& halo_block() { return _haloblock; }
 
+  /**
+   * Returns the \ref HaloUpdateMode used for halo updates
+   */
+  HaloUpdateMode update_mode() const { return _mode; }
+
   /**
    * Initiates a blocking halo region update for all halo elements.
    */
   void update() {
-    for(auto& region : _region_data) {
-      update_halo_intern(region.second);
-    }
+    update_async();
     wait();
   }
 
@@ -275,20 +231,23 @@ public:
    * the given region.
    */
   void update_at(region_index_t index) {
-    auto it_find = _region_data.find(index);
-    if(it_find != _region_data.end()) {
-      update_halo_intern(it_find->second);
-      dart_wait_local(&it_find->second.handle);
-    }
+    update_async_at(index);
+    wait(index);
   }
 
   /**
    * Initiates an asychronous halo region update for all halo elements.
+   *
+   * In push mode, the calling unit also releases its halo regions for the
+   * next update by its neighbors and pushes its boundaries to them.
    */
   void update_async() {
     for(auto& region : _region_data) {
       update_halo_intern(region.second);
     }
+    for(auto& push : _push_data) {
+      push_boundary(push.second);
+    }
   }
 
   /**
@@ -300,15 +259,24 @@ public:
     if(it_find != _region_data.end()) {
       update_halo_intern(it_find->second);
     }
+    auto it_push = _push_data.find(index);
+    if(it_push != _push_data.end()) {
+      push_boundary(it_push->second);
+    }
   }
 
   /**
    * Waits until all halo updates are finished. Only useful for asynchronous
    * halo updates.
+   *
+   * In push mode, this only waits for the neighbors of the calling unit.
    */
   void wait() {
+    for(auto& push : _push_data) {
+      wait_push(push.second);
+    }
     for(auto& region : _region_data) {
-      dart_wait_local(&region.second.handle);
+      wait_halo(region.second);
     }
   }
 
@@ -317,9 +285,30 @@ public:
    * Only useful for asynchronous halo updates.
    */
   void wait(region_index_t index) {
+    auto it_push = _push_data.find(index);
+    if(it_push != _push_data.end())
+      wait_push(it_push->second);
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end())
-      dart_wait_local(it_find->second.handle);
+      wait_halo(it_find->second);
+  }
+
+  /**
+   * Tests without blocking whether the halo update for the given halo region
+   * is finished. Only useful for asynchronous halo updates.
+   *
+   * In push mode, this also progresses the pushes of the calling unit's
+   * boundaries, so neighbors polling their halo regions are not blocked.
+   */
+  bool test(region_index_t index) {
+    for(auto& push : _push_data) {
+      progress_push(push.second);
+    }
+    auto it_find = _region_data.find(index);
+    if(it_find == _region_data.end())
+      return true;
+
+    return test_halo(it_find->second);
   }
 
   /**
@@ -447,17 +436,403 @@ public:
   }
 
 private:
+  /*
+   * Record published by every unit for each of its halo regions in push
+   * mode. The layout fields are written once before the neighbors read
+   * them, the counters are only modified atomically.
+   */
+  struct Signal {
+    // offset of the halo region in the halo buffer, -1 if not pushed
+    int64_t offset;
+    // unit pushing into the halo region
+    int64_t source;
+    // number of elements in the halo region
+    int64_t size;
+    // number of completed pushes into the halo region
+    int64_t notify;
+    // number of updates of the unit receiving the boundary region
+    int64_t release;
+  };
+
   struct Data {
-    const Region_t&                     region;
-    std::function<void(dart_handle_t&)> get_halos;
-    dart_handle_t                       handle{};
+    Data(const Region_t& region, Element_t* halo_mem, dart_datatype_t type)
+    : region(region), halo_mem(halo_mem), type(type) {}
+
+    const Region_t& region;
+    Element_t*      halo_mem;
+    dart_datatype_t type;
+    dart_handle_t   handle = DART_HANDLE_NULL;
+    // release counter at the unit pushing into the region (push mode)
+    dart_gptr_t     gptr_release = DART_GPTR_NULL;
+    int64_t         generation   = 0;
+  };
+
+  /*
+   * Layout of the region elements at the unit owning them: blocks of
+   * contiguous elements of the same size in the iteration order of the
+   * region.
+   */
+  struct RegionBlocks {
+    pattern_size_t               block_size;
+    std::vector<pattern_index_t> offsets;
+  };
+
+  struct PushData {
+    PushData(const Region_t& region, const Element_t* boundary_mem,
+             dart_datatype_t type, dart_gptr_t gptr_halo,
+             dart_gptr_t gptr_notify)
+    : region(region), boundary_mem(boundary_mem), type(type),
+      gptr_halo(gptr_halo), gptr_notify(gptr_notify) {}
+
+    // boundary elements of the calling unit
+    const Region_t   region;
+    const Element_t* boundary_mem;
+    dart_datatype_t  type;
+    // halo region and notify counter at the receiving unit
+    dart_gptr_t      gptr_halo;
+    dart_gptr_t      gptr_notify;
+    dart_handle_t    handle     = DART_HANDLE_NULL;
+    int64_t          generation = 0;
+    // pushed but the receiving unit is not notified yet
+    bool             pending    = false;
+    bool             posted     = false;
+    // boundary elements packed into a contiguous buffer before the push
+    bool                   packed = false;
+    RegionBlocks           blocks;
+    std::vector<Element_t> pack_buffer;
   };
 
+  /*
+   * Returns the blocks of the region elements with offsets relative to the
+   * first element of the region.
+   */
+  RegionBlocks region_blocks(const Region_t& region) const {
+    RegionBlocks blocks{ 1, {} };
+    auto         rel_dim = region.spec().relevant_dim();
+    auto         level   = region.spec().level();
+
+    if(level == 1) {
+      if(MemoryArrange == ROW_MAJOR) {
+        for(auto i = rel_dim - 1; i < NumDimensions; ++i)
+          blocks.block_size *= region.view().extent(i);
+      } else {
+        for(auto i = 0; i < rel_dim; ++i)
+          blocks.block_size *= region.view().extent(i);
+      }
+    }
+    // TODO more optimizations
+    else {
+      blocks.block_size *= (MemoryArrange == ROW_MAJOR)
+                             ? region.view().extent(NumDimensions - 1)
+                             : region.view().extent(0);
+    }
+
+    pattern_size_t num_blocks  = region.size() / blocks.block_size;
+    auto           it          = region.begin();
+    auto           start_index = it.lpos().index;
+    blocks.offsets.resize(num_blocks);
+    for(auto& offset : blocks.offsets) {
+      offset = it.lpos().index - start_index;
+      it += blocks.block_size;
+    }
+
+    return blocks;
+  }
+
+  /*
+   * Creates the DART datatype describing the memory layout of the region
+   * elements at the unit owning them.
+   */
+  dart_datatype_t region_datatype(const Region_t& region) {
+    auto            blocks     = region_blocks(region);
+    auto            num_blocks = blocks.offsets.size();
+    auto            ds_num_elems_block =
+      dart_storage<Element_t>(blocks.block_size);
+    dart_datatype_t region_type;
+
+    if(region.spec().level() == 1) {
+      pattern_size_t stride =
+        (num_blocks > 1) ? std::abs(blocks.offsets[1] - blocks.offsets[0])
+                         : 1;
+      auto ds_stride = dart_storage<Element_t>(stride);
+      dart_type_create_strided(ds_num_elems_block.dtype, ds_stride.nelem,
+                               ds_num_elems_block.nelem, &region_type);
+    }
+    // TODO more optimizations
+    else {
+      std::vector<size_t> block_sizes(num_blocks, ds_num_elems_block.nelem);
+      std::vector<size_t> block_offsets(num_blocks);
+      for(std::size_t i = 0; i < num_blocks; ++i) {
+        block_offsets[i] =
+          dart_storage<Element_t>(blocks.offsets[i]).nelem;
+      }
+      dart_type_create_indexed(
+        ds_num_elems_block.dtype,
+        num_blocks,            // number of blocks
+        block_sizes.data(),    // size of each block
+        block_offsets.data(),  // offset of first element of each block
+        &region_type);
+    }
+    _dart_types.push_back(region_type);
+
+    return region_type;
+  }
+
+  /*
+   * Registers the halo buffer, publishes the halo region layout and sets
+   * up the boundary regions pushed to the neighbors.
+   */
+  void init_push() {
+    auto&       team    = _matrix.team();
+    const auto& pattern = _matrix.pattern();
+    auto        myid    = team.myid();
+
+    auto& halo_buffer = _halomemory.buffer();
+    auto  ds_halo     = dart_storage<Element_t>(halo_buffer.size());
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister(team.dart_id(), ds_halo.nelem, ds_halo.dtype,
+                            halo_buffer.data(), &_halo_gptr),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team.dart_id(), sizeof(Signal) * MaxIndex,
+                                 DART_TYPE_BYTE, &_signal_gptr),
+      DART_OK);
+
+    Signal* signals    = nullptr;
+    auto    gptr_local = signal_gptr(myid, 0, 0);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(gptr_local, reinterpret_cast<void**>(&signals)),
+      DART_OK);
+    std::fill_n(signals, MaxIndex, Signal{ -1, -1, 0, 0, 0 });
+
+    for(auto& region_data : _region_data) {
+      auto&       data   = region_data.second;
+      const auto& region = data.region;
+      if(region.is_custom_region())
+        continue;
+
+      auto& signal  = signals[region.index()];
+      signal.offset = data.halo_mem - halo_buffer.data();
+      signal.source = region.begin().lpos().unit.id;
+      signal.size   = region.size();
+      data.gptr_release =
+        signal_gptr(team_unit_t(signal.source), region.index(),
+                    offsetof(Signal, release));
+    }
+    team.barrier();
+
+    /*
+     * The halo region of the receiving unit in direction of the region
+     * spec is the boundary of this unit in the opposite direction.
+     */
+    for(const auto& spec : _halo_spec.specs()) {
+      ViewSpec_t  boundary_view;
+      team_unit_t target;
+      if(!internal::neighbor_halo_view(pattern, _view_global, _cycle_spec,
+                                       spec, boundary_view, target))
+        continue;
+
+      auto   index  = spec.index();
+      Signal signal;
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(&signal, signal_gptr(target, index, 0),
+                          offsetof(Signal, notify), DART_TYPE_BYTE,
+                          DART_TYPE_BYTE),
+        DART_OK);
+      if(signal.offset < 0)
+        continue;
+
+      _push_data.insert(std::make_pair(
+        index, PushData(Region_t(spec, boundary_view,
+                                 _matrix.begin().globmem(), pattern,
+                                 typename Region_t::Border_t{}, false),
+                        nullptr, DART_TYPE_UNDEFINED, DART_GPTR_NULL,
+                        signal_gptr(target, index,
+                                    offsetof(Signal, notify)))));
+      auto& push = _push_data.find(index)->second;
+      DASH_ASSERT_MSG(signal.source == myid.id
+                        && signal.size
+                             == static_cast<int64_t>(push.region.size()),
+                      "Halo region of the neighbor does not match the "
+                      "boundary region");
+
+      push.boundary_mem = _matrix.lbegin() + push.region.begin().lpos().index;
+      push.blocks       = region_blocks(push.region);
+      push.packed       = pack_region(push.blocks);
+      if(push.packed)
+        push.pack_buffer.resize(push.region.size());
+      else
+        push.type = region_datatype(push.region);
+      push.gptr_halo    = _halo_gptr;
+      dart_gptr_setunit(&push.gptr_halo, target);
+      dart_gptr_incaddr(&push.gptr_halo, signal.offset * sizeof(Element_t));
+    }
+  }
+
+  dart_gptr_t signal_gptr(team_unit_t unit, region_index_t index,
+                          size_t field_offset) const {
+    auto gptr = _signal_gptr;
+    dart_gptr_setunit(&gptr, unit);
+    dart_gptr_incaddr(&gptr, index * sizeof(Signal) + field_offset);
+
+    return gptr;
+  }
+
+  static int64_t signal_load(dart_gptr_t gptr) {
+    int64_t value  = 0;
+    int64_t result = 0;
+    dart_fetch_and_op(gptr, &value, &result, dart_datatype<int64_t>::value,
+                      DART_OP_NO_OP);
+    dart_flush(gptr);
+
+    return result;
+  }
+
+  static void signal_increment(dart_gptr_t gptr) {
+    int64_t value = 1;
+    dart_accumulate(gptr, &value, 1, dart_datatype<int64_t>::value,
+                    DART_OP_SUM);
+    dart_flush(gptr);
+  }
+
   void update_halo_intern(Data& data) {
     if(data.region.is_custom_region())
       return;
 
-    data.get_halos(data.handle);
+    if(_mode == HaloUpdateMode::PUSH) {
+      // the halo region may be overwritten by the next push
+      ++data.generation;
+      signal_increment(data.gptr_release);
+      return;
+    }
+
+    dart_get_handle(data.halo_mem, data.region.begin().dart_gptr(),
+                    dart_storage<Element_t>(data.region.size()).nelem,
+                    data.type, dart_storage<Element_t>::dtype, &data.handle);
+  }
+
+  void wait_halo(Data& data) {
+    if(_mode == HaloUpdateMode::PULL) {
+      dart_wait_local(&data.handle);
+      return;
+    }
+    if(data.region.is_custom_region())
+      return;
+
+    auto gptr_notify = signal_gptr(_matrix.team().myid(),
+                                   data.region.index(),
+                                   offsetof(Signal, notify));
+    while(signal_load(gptr_notify) < data.generation) {
+    }
+  }
+
+  bool test_halo(Data& data) {
+    if(_mode == HaloUpdateMode::PULL) {
+      int32_t finished = 0;
+      dart_test_local(&data.handle, &finished);
+      return finished != 0;
+    }
+    if(data.region.is_custom_region())
+      return true;
+
+    auto gptr_notify = signal_gptr(_matrix.team().myid(),
+                                   data.region.index(),
+                                   offsetof(Signal, notify));
+    return signal_load(gptr_notify) >= data.generation;
+  }
+
+  /*
+   * Puts the boundary region into the halo region of the receiving unit
+   * once it released the halo region of the previous update.
+   */
+  void push_boundary(PushData& push) {
+    ++push.generation;
+    if(push.packed)
+      pack_boundary(push);
+    push.pending = true;
+    push.posted  = post_push(push);
+  }
+
+  /*
+   * Regions with many small blocks are packed, as datatypes with small
+   * blocks are handled slowly by many MPI implementations.
+   */
+  static bool pack_region(const RegionBlocks& blocks) {
+    return blocks.offsets.size() > 1
+           && blocks.block_size * sizeof(Element_t) < PackBlockBytesMax;
+  }
+
+  /*
+   * Packs the boundary elements into the contiguous push buffer.
+   */
+  static void pack_boundary(PushData& push) {
+    const auto block_size = push.blocks.block_size;
+    auto*      out        = push.pack_buffer.data();
+    for(auto offset : push.blocks.offsets) {
+      const auto* in = push.boundary_mem + offset;
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+      #pragma omp simd
+#endif
+      for(pattern_size_t i = 0; i < block_size; ++i)
+        out[i] = in[i];
+      out += block_size;
+    }
+  }
+
+  bool post_push(PushData& push) {
+    auto gptr_release = signal_gptr(_matrix.team().myid(),
+                                    push.region.spec().index(),
+                                    offsetof(Signal, release));
+    if(signal_load(gptr_release) < push.generation)
+      return false;
+
+    auto ds_region = dart_storage<Element_t>(push.region.size());
+    if(push.packed) {
+      dart_put_handle(push.gptr_halo, push.pack_buffer.data(),
+                      ds_region.nelem, ds_region.dtype, ds_region.dtype,
+                      &push.handle);
+    } else {
+      dart_put_handle(push.gptr_halo, push.boundary_mem, ds_region.nelem,
+                      push.type, dart_storage<Element_t>::dtype,
+                      &push.handle);
+    }
+
+    return true;
+  }
+
+  void wait_push(PushData& push) {
+    if(!push.pending)
+      return;
+
+    while(!push.posted) {
+      push.posted = post_push(push);
+    }
+    // remote completion before the receiving unit is notified
+    dart_wait(&push.handle);
+    signal_increment(push.gptr_notify);
+    push.pending = false;
+  }
+
+  /*
+   * Posts a deferred push and notifies the receiving unit once the push
+   * completed, without blocking.
+   */
+  void progress_push(PushData& push) {
+    if(!push.pending)
+      return;
+
+    if(!push.posted) {
+      push.posted = post_push(push);
+      if(!push.posted)
+        return;
+    }
+    int32_t finished = 0;
+    dart_test(&push.handle, &finished);
+    if(!finished)
+      return;
+
+    signal_increment(push.gptr_notify);
+    push.pending = false;
   }
 
   Element_t* halo_element_at(ElementCoords_t& coords) {
@@ -475,6 +850,7 @@ private:
 
 private:
   MatrixT&                       _matrix;
+  const HaloUpdateMode           _mode;
   const GlobBoundSpec_t          _cycle_spec;
   const HaloSpec_t               _halo_spec;
   const ViewSpec_t               _view_global;
@@ -482,7 +858,10 @@ private:
   const ViewSpec_t&              _view_local;
   HaloMemory_t                   _halomemory;
   std::map<region_index_t, Data> _region_data;
+  std::map<region_index_t, PushData> _push_data;
   std::vector<dart_datatype_t>   _dart_types;
+  dart_gptr_t                    _halo_gptr   = DART_GPTR_NULL;
+  dart_gptr_t                    _signal_gptr = DART_GPTR_NULL;
 };
 
 }  // namespace halo
@@ -3,6 +3,17 @@
 
 #include <dash/halo/iterator/StencilIterator.h>
 
+#include <dash/util/IndexSequence.h>
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
 namespace dash {
 
 namespace halo {
@@ -32,6 +43,8 @@ private:
 
   using StencilOperator_t = StencilOperator<ElementT, PatternT, GlobMemT, StencilSpecT>;
   using pattern_size_t    = typename StencilOperator_t::pattern_size_t;
+  using signed_pattern_size_t =
+    typename StencilOperator_t::signed_pattern_size_t;
 
 public:
   using ViewSpec_t      = typename StencilOperator_t::ViewSpec_t;
@@ -212,7 +225,92 @@ public:
     }
   }
 
+  /**
+   * Updates all inner elements with the weighted stencil points in bulk.
+   * Every destination element is set to the result of the given operation
+   * done on the center multiplied with the center coefficient and all
+   * stencil points multiplied with their coefficient (\ref StencilPoint),
+   * like \ref get_value_at.
+   *
+   * Rows of contiguous inner elements are updated in unit-stride loops with
+   * unrolled stencil points and are distributed among the threads if
+   * OpenMP is enabled.
+   *
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param coefficient_center coefficient for the center
+   * \param op operation to use (e.g. std::plus)
+   */
+  template <typename BinaryFunc>
+  void update(ElementT* begin_dst, ElementT coefficient_center,
+              BinaryFunc op) {
+    constexpr dim_t row_dim =
+      (StencilOperator_t::MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+    const auto& view     = this->view();
+    const auto  dim_offs = StencilOperator_t::dimension_offsets(
+      _stencil_op->_view_local->extents());
+    const auto& stencil_offs = _stencil_op->_stencil_offsets;
+    if(view.size() == 0)
+      return;
+
+    std::array<ElementT, NumStencilPoints> coefficients;
+    for(std::size_t i = 0; i < NumStencilPoints; ++i)
+      coefficients[i] = _stencil_op->_stencil_spec[i].coefficient();
+
+    const pattern_size_t row_len  = view.extent(row_dim);
+    const pattern_size_t num_rows = view.size() / row_len;
+    const ElementT*      src      = _stencil_op->_local_memory;
+
+#ifdef DASH_ENABLE_OPENMP
+    dash::util::UnitLocality uloc;
+    auto n_threads = uloc.num_domain_threads();
+    #pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+    for(signed_pattern_size_t row = 0;
+        row < static_cast<signed_pattern_size_t>(num_rows); ++row) {
+      // offset of the first row element, rows enumerated in memory order
+      signed_pattern_size_t offset = view.offset(row_dim) * dim_offs[row_dim];
+      auto                  index  = row;
+      for(dim_t i = 0; i < NumDimensions - 1; ++i) {
+        dim_t d = (StencilOperator_t::MemoryArrange == ROW_MAJOR)
+                    ? NumDimensions - 2 - i
+                    : i + 1;
+        offset += (view.offset(d) + index % view.extent(d)) * dim_offs[d];
+        index /= view.extent(d);
+      }
+
+      update_row(src + offset, begin_dst + offset, row_len, coefficient_center,
+                 coefficients, stencil_offs, op,
+                 dash::ce::make_index_sequence<NumStencilPoints>());
+    }
+  }
+
 private:
+  /*
+   * Updates a row of contiguous elements, the stencil points are unrolled
+   * at compile time.
+   */
+  template <typename BinaryFunc, std::size_t... Points>
+  static void update_row(
+    const ElementT* src, ElementT* dst, pattern_size_t row_len,
+    ElementT                                      coefficient_center,
+    const std::array<ElementT, NumStencilPoints>& coefficients,
+    const StencilOffsets_t& stencil_offs, BinaryFunc op,
+    dash::ce::index_sequence<Points...>) {
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+    #pragma omp simd
+#endif
+    for(pattern_size_t i = 0; i < row_len; ++i) {
+      ElementT value = coefficient_center * src[i];
+      // expands to one operation per stencil point
+      int expand[] = { 0, (value = op(value, coefficients[Points]
+                                               * src[i + stencil_offs[Points]]),
+                           0)... };
+      (void) expand;
+      dst[i] = value;
+    }
+  }
+
   template <dim_t dim, typename Op>
   struct Loop {
     template <typename OffsetT>
@@ -363,8 +461,12 @@ public:
     const auto&    bnd_views = _stencil_op->_spec_views.boundary_views();
     pattern_size_t offset    = 0;
     auto           it_views  = std::begin(bnd_views);
-    for(dim_t d = 0; d < dim; ++d, ++it_views)
-      offset += it_views->size() + (++it_views)->size();
+    for(dim_t d = 0; d < dim; ++d) {
+      offset += it_views->size();
+      ++it_views;
+      offset += it_views->size();
+      ++it_views;
+    }
 
     if(pos == RegionPos::POST) {
       offset += it_views->size();
@@ -689,7 +791,367 @@ public:
     return offset;
   }
 
+  /**
+   * Performs multiple time steps of a user-defined stencil operation on all
+   * local elements between two halo updates (deep halos).
+   *
+   * The halo regions have to be at least \c num_steps times the stencil
+   * radius wide (see \ref MultiStepStencilSpec). The local block and all
+   * halo elements are copied to an extended block. Every time step updates
+   * the elements of the extended block that are still valid, i.e. the
+   * updated region shrinks by the stencil radius with every step until the
+   * last step covers the local block only. Halo elements at global
+   * boundaries are not updated and elements with stencil points outside of
+   * the global domain keep their values.
+   *
+   * The operation is called like the operation of
+   * \ref StencilOperatorInner::update, but offsets and stencil offsets
+   * relate to the extended block.
+   *
+   * \param num_steps number of time steps
+   * \param begin_dst Pointer to the beginning of the destination memory for
+   *                  the local elements after the last time step
+   * \param operation User-defined operation for updating an element
+   */
+  template <typename Op>
+  void update_steps(std::size_t num_steps, ElementT* begin_dst,
+                    Op operation) {
+    update_steps_tiles(num_steps, begin_dst, operation, 0);
+  }
+
+  /**
+   * Performs multiple time steps like \ref update_steps, but with temporal
+   * blocking: the extended block is split into tiles along the outermost
+   * dimension and all time steps are performed for a tile before the next
+   * tile is updated, so the elements of a tile are reused from the cache
+   * instead of streaming the whole block from memory in every step.
+   *
+   * The tiles are skewed by the stencil radius with every step (wavefront),
+   * every element is computed once per step from the same values as in
+   * \ref update_steps, so the results are identical.
+   *
+   * \param num_steps   number of time steps
+   * \param begin_dst   Pointer to the beginning of the destination memory
+   *                    for the local elements after the last time step
+   * \param operation   User-defined operation for updating an element
+   * \param tile_extent extent of a tile in the outermost dimension, derived
+   *                    from the L2 cache size if 0
+   */
+  template <typename Op>
+  void update_steps_tiled(std::size_t num_steps, ElementT* begin_dst,
+                          Op operation, pattern_size_t tile_extent = 0) {
+    if(tile_extent == 0) {
+      tile_extent = steps_tile_extent(num_steps);
+    }
+    update_steps_tiles(num_steps, begin_dst, operation, tile_extent);
+  }
+
 private:
+  /*
+   * Default tile extent of update_steps_tiled: both extended blocks of a
+   * tile and the rows required by the skew of the time steps fit into the
+   * L2 cache.
+   */
+  pattern_size_t steps_tile_extent(std::size_t num_steps) const {
+    constexpr dim_t tile_dim =
+      (MemoryArrange == ROW_MAJOR) ? 0 : NumDimensions - 1;
+    // fallback if the cache size is unknown
+    constexpr pattern_size_t cache_bytes_default = 256 * 1024;
+
+    dash::util::UnitLocality uloc;
+    auto cache_bytes = uloc.cache_size(1);
+    pattern_size_t cache_size = (cache_bytes > 0)
+                                  ? static_cast<pattern_size_t>(cache_bytes)
+                                  : cache_bytes_default;
+
+    const auto     minmax = _stencil_spec.minmax_distances();
+    pattern_size_t skew   = std::max<pattern_index_t>(
+      -minmax[tile_dim].first, minmax[tile_dim].second);
+    pattern_size_t slice_size = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(d == tile_dim)
+        continue;
+      const auto& halo_ext = _halo_block->halo_extension_max(d);
+      slice_size *= halo_ext.first + _view_local->extent(d) + halo_ext.second;
+    }
+    pattern_size_t tile_rows = cache_size / (2 * slice_size * sizeof(ElementT));
+    pattern_size_t skew_rows = num_steps * skew;
+
+    return (tile_rows > skew_rows + 1) ? tile_rows - skew_rows : 1;
+  }
+
+  /*
+   * Implementation of update_steps and update_steps_tiled, a tile extent
+   * of 0 updates the whole extended block in every step.
+   */
+  template <typename Op>
+  void update_steps_tiles(std::size_t num_steps, ElementT* begin_dst,
+                          Op operation, pattern_size_t tile_extent) {
+    DASH_ASSERT_GT(num_steps, 0, "At least one time step required");
+
+    using RegionCoords_t = RegionCoords<NumDimensions>;
+
+    const auto& view_local = *_view_local;
+    const auto  minmax     = _stencil_spec.minmax_distances();
+
+    // layout of the extended block
+    ElementCoords_t ext_offsets;
+    ElementCoords_t ext_extents;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      const auto& halo_ext = _halo_block->halo_extension_max(d);
+      ext_offsets[d]       = halo_ext.first;
+      ext_extents[d] = halo_ext.first + view_local.extent(d) + halo_ext.second;
+    }
+    const auto ext_dim_offs = dimension_offsets(ext_extents);
+
+    /*
+     * Region updated with 'rem' remaining steps in dimension d:
+     * [lower_base[d] - rem * lower_grow[d], upper_base[d] + rem *
+     * upper_grow[d]). Halo regions only grow the region if they contain
+     * data of neighbors.
+     */
+    ElementCoords_t lower_base, lower_grow, upper_base, upper_grow;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      pattern_index_t radius_pre  = -minmax[d].first;
+      pattern_index_t radius_post = minmax[d].second;
+      auto*           region_pre =
+        _halo_block->halo_region(RegionCoords_t::index(d, RegionPos::PRE));
+      auto* region_post =
+        _halo_block->halo_region(RegionCoords_t::index(d, RegionPos::POST));
+
+      lower_base[d] = ext_offsets[d];
+      lower_grow[d] = 0;
+      if(region_pre == nullptr || region_pre->size() == 0) {
+        lower_base[d] += radius_pre;
+      } else if(!region_pre->is_custom_region()) {
+        DASH_ASSERT_MSG(
+          static_cast<pattern_index_t>(region_pre->view().extent(d))
+            >= static_cast<pattern_index_t>(num_steps) * radius_pre,
+          "Halo region extent lower than required for the time steps");
+        lower_grow[d] = radius_pre;
+      }
+
+      upper_base[d] = ext_offsets[d] + view_local.extent(d);
+      upper_grow[d] = 0;
+      if(region_post == nullptr || region_post->size() == 0) {
+        upper_base[d] -= radius_post;
+      } else if(!region_post->is_custom_region()) {
+        DASH_ASSERT_MSG(
+          static_cast<pattern_index_t>(region_post->view().extent(d))
+            >= static_cast<pattern_index_t>(num_steps) * radius_post,
+          "Halo region extent lower than required for the time steps");
+        upper_grow[d] = radius_post;
+      }
+    }
+
+    StencilOffsets_t ext_stencil_offs;
+    for(auto i = 0; i < NumStencilPoints; ++i) {
+      signed_pattern_size_t offset = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        offset += _stencil_spec[i][d] * ext_dim_offs[d];
+      ext_stencil_offs[i] = offset;
+    }
+
+    // copy local and halo elements to the extended block
+    pattern_size_t ext_size = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      ext_size *= ext_extents[d];
+    auto& buffer_src = _steps_buffers[0];
+    buffer_src.assign(ext_size, ElementT());
+
+    ElementCoords_t local_upper;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      local_upper[d] = ext_offsets[d] + view_local.extent(d);
+    const auto local_dim_offs = dimension_offsets(view_local.extents());
+    for_each_row(ext_offsets, local_upper,
+                 [&](const ElementCoords_t& coords, pattern_size_t len) {
+                   std::copy_n(
+                     _local_memory
+                       + row_offset(coords, ext_offsets, local_dim_offs),
+                     len,
+                     buffer_src.data() + row_offset(coords, ext_dim_offs));
+                 });
+
+    for(const auto& region : _halo_block->halo_regions()) {
+      if(region.size() == 0)
+        continue;
+
+      const auto&     spec = region.spec();
+      ElementCoords_t region_lower;
+      ElementCoords_t region_upper;
+      ElementCoords_t region_extents;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        region_extents[d] = region.view().extent(d);
+        region_lower[d]   = ext_offsets[d];
+        if(spec[d] == 0)
+          region_lower[d] -= region_extents[d];
+        else if(spec[d] == 2)
+          region_lower[d] += view_local.extent(d);
+        region_upper[d] = region_lower[d] + region_extents[d];
+      }
+      const auto  region_dim_offs = dimension_offsets(region_extents);
+      const auto* halo_mem =
+        &*(_halo_memory->first_element_at(region.index()));
+      for_each_row(region_lower, region_upper,
+                   [&](const ElementCoords_t& coords, pattern_size_t len) {
+                     std::copy_n(
+                       halo_mem
+                         + row_offset(coords, region_lower, region_dim_offs),
+                       len,
+                       buffer_src.data() + row_offset(coords, ext_dim_offs));
+                   });
+    }
+    // elements not updated in a step keep their values in both buffers
+    _steps_buffers[1] = buffer_src;
+
+    /*
+     * Tiles along the outermost dimension, tile t covers
+     * [tiles_begin + t * tile_extent - step * skew,
+     *  tiles_begin + (t + 1) * tile_extent - step * skew) in a step, the
+     * first and last tile are unbounded. With a skew not lower than the
+     * stencil radius, all elements read by a step of a tile are computed
+     * by preceding tiles or steps and no element is overwritten in the
+     * ping-pong buffers before all steps reading it are done.
+     */
+    constexpr dim_t tile_dim =
+      (MemoryArrange == ROW_MAJOR) ? 0 : NumDimensions - 1;
+    const pattern_index_t skew = std::max<pattern_index_t>(
+      -minmax[tile_dim].first, minmax[tile_dim].second);
+    const pattern_index_t tiles_begin =
+      lower_base[tile_dim] - (num_steps - 1) * lower_grow[tile_dim];
+    const pattern_index_t tiles_end =
+      upper_base[tile_dim] + (num_steps - 1) * upper_grow[tile_dim];
+    const pattern_index_t tile_ext  = tile_extent;
+    pattern_index_t       num_tiles = 1;
+    if(tile_ext > 0 && tiles_end > tiles_begin) {
+      num_tiles = (tiles_end - tiles_begin + tile_ext - 1) / tile_ext;
+    }
+
+    for(pattern_index_t tile = 0; tile < num_tiles; ++tile) {
+      for(std::size_t step = 1; step <= num_steps; ++step) {
+        const pattern_index_t rem = num_steps - step;
+        const pattern_index_t tile_skew =
+          static_cast<pattern_index_t>(step) * skew;
+        const auto* src = _steps_buffers[(step - 1) % 2].data();
+        auto*       dst = _steps_buffers[step % 2].data();
+
+        ElementCoords_t lower;
+        ElementCoords_t upper;
+        for(dim_t d = 0; d < NumDimensions; ++d) {
+          lower[d] = lower_base[d] - rem * lower_grow[d];
+          upper[d] = upper_base[d] + rem * upper_grow[d];
+        }
+        if(tile > 0) {
+          lower[tile_dim] = std::max<pattern_index_t>(
+            lower[tile_dim], tiles_begin + tile * tile_ext - tile_skew);
+        }
+        if(tile < num_tiles - 1) {
+          upper[tile_dim] = std::min<pattern_index_t>(
+            upper[tile_dim],
+            tiles_begin + (tile + 1) * tile_ext - tile_skew);
+        }
+        for_each_row(lower, upper,
+                     [&](const ElementCoords_t& coords, pattern_size_t len) {
+                       auto offset     = row_offset(coords, ext_dim_offs);
+                       auto center     = const_cast<ElementT*>(src) + offset;
+                       auto center_dst = dst + offset;
+                       for(pattern_size_t i = 0; i < len; ++i, ++offset,
+                                          ++center, ++center_dst) {
+                         operation(center, center_dst, offset,
+                                   ext_stencil_offs);
+                       }
+                     });
+      }
+    }
+
+    const auto& buffer_dst = _steps_buffers[num_steps % 2];
+    for_each_row(ext_offsets, local_upper,
+                 [&](const ElementCoords_t& coords, pattern_size_t len) {
+                   std::copy_n(
+                     buffer_dst.data() + row_offset(coords, ext_dim_offs),
+                     len,
+                     begin_dst
+                       + row_offset(coords, ext_offsets, local_dim_offs));
+                 });
+  }
+
+  /*
+   * Returns the offsets between two neighboring elements in every dimension
+   * for a block with the given extents.
+   */
+  template <typename ExtentsT>
+  static std::array<signed_pattern_size_t, NumDimensions> dimension_offsets(
+    const ExtentsT& extents) {
+    std::array<signed_pattern_size_t, NumDimensions> dim_offs;
+    if(MemoryArrange == ROW_MAJOR) {
+      dim_offs[NumDimensions - 1] = 1;
+      for(auto d = NumDimensions - 1; d > 0;) {
+        --d;
+        dim_offs[d] = dim_offs[d + 1] * extents[d + 1];
+      }
+    } else {
+      dim_offs[0] = 1;
+      for(auto d = 1; d < NumDimensions; ++d)
+        dim_offs[d] = dim_offs[d - 1] * extents[d - 1];
+    }
+
+    return dim_offs;
+  }
+
+  static signed_pattern_size_t row_offset(
+    const ElementCoords_t&                                  coords,
+    const std::array<signed_pattern_size_t, NumDimensions>& dim_offs) {
+    signed_pattern_size_t offset = 0;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      offset += coords[d] * dim_offs[d];
+
+    return offset;
+  }
+
+  static signed_pattern_size_t row_offset(
+    const ElementCoords_t&                                  coords,
+    const ElementCoords_t&                                  origin,
+    const std::array<signed_pattern_size_t, NumDimensions>& dim_offs) {
+    signed_pattern_size_t offset = 0;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      offset += (coords[d] - origin[d]) * dim_offs[d];
+
+    return offset;
+  }
+
+  /*
+   * Calls func(coords, length) for every row of contiguous elements within
+   * [lower, upper), coords are the coordinates of the first row element.
+   */
+  template <typename FuncT>
+  static void for_each_row(const ElementCoords_t& lower,
+                           const ElementCoords_t& upper, FuncT func) {
+    constexpr dim_t row_dim =
+      (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(upper[d] <= lower[d])
+        return;
+    }
+
+    auto           coords  = lower;
+    pattern_size_t row_len = upper[row_dim] - lower[row_dim];
+    while(true) {
+      func(coords, row_len);
+
+      bool done = true;
+      for(dim_t i = 0; i < NumDimensions - 1; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 2 - i : i + 1;
+        if(++coords[d] < upper[d]) {
+          done = false;
+          break;
+        }
+        coords[d] = lower[d];
+      }
+      if(done)
+        return;
+    }
+  }
+
   StencilOffsets_t set_stencil_offsets() {
     StencilOffsets_t stencil_offs;
     for(auto i = 0; i < NumStencilPoints; ++i) {
@@ -748,6 +1210,9 @@ private:
   iterator_inner _iend;
   iterator_bnd   _bbegin;
   iterator_bnd   _bend;
+
+  // extended blocks used by update_steps
+  std::array<std::vector<ElementT>, 2> _steps_buffers;
 };
 
 }  // namespace halo
@@ -0,0 +1,249 @@
+#ifndef DASH__HALO_STENCILSTEP_H
+#define DASH__HALO_STENCILSTEP_H
+
+#include <dash/halo/HaloMatrixWrapper.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace dash {
+
+namespace halo {
+
+namespace internal {
+
+/*
+ * Returns the indices of all halo regions accessed by the stencil points
+ * of the elements within the given boundary view.
+ */
+template <dim_t NumDimensions, typename IndexT, typename StencilSpecT>
+std::vector<typename RegionCoords<NumDimensions>::region_index_t>
+accessed_halo_regions(const ViewSpec<NumDimensions, IndexT>& view,
+                      const ViewSpec<NumDimensions, IndexT>& view_local,
+                      const StencilSpecT&                    stencil_spec) {
+  using RegionCoords_t = RegionCoords<NumDimensions>;
+  using region_index_t = typename RegionCoords_t::region_index_t;
+  using signed_index_t = typename std::make_signed<IndexT>::type;
+
+  std::vector<region_index_t> indices;
+  if(view.size() == 0)
+    return indices;
+
+  for(const auto& stencil : stencil_spec.specs()) {
+    // region coordinates reached in every dimension
+    std::array<std::array<bool, 3>, NumDimensions> reached;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      signed_index_t lower = view.offset(d) + stencil[d];
+      signed_index_t upper = lower + view.extent(d);
+      signed_index_t extent = view_local.extent(d);
+      reached[d] = { { lower < 0, lower < extent && upper > 0,
+                       upper > extent } };
+    }
+
+    for(region_index_t index = 0; index < RegionCoords_t::MaxIndex;
+        ++index) {
+      auto coords = RegionCoords_t::coords(index);
+      bool center = true;
+      bool found  = true;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        center &= coords[d] == 1;
+        found &= reached[d][coords[d]];
+      }
+      if(found && !center)
+        indices.push_back(index);
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+  return indices;
+}
+
+}  // namespace internal
+
+/**
+ * Pair of matrices with a \ref HaloMatrixWrapper and a \ref StencilOperator
+ * each, used as source and destination of stencil steps in turn
+ * (see \ref stencil_step).
+ *
+ * The matrices must have the same pattern.
+ */
+template <typename MatrixT, typename StencilSpecT>
+class HaloDoubleBuffer {
+public:
+  using HaloWrapper_t     = HaloMatrixWrapper<MatrixT>;
+  using Element_t         = typename HaloWrapper_t::Element_t;
+  using GlobBoundSpec_t   = typename HaloWrapper_t::GlobBoundSpec_t;
+  using StencilOperator_t = decltype(std::declval<HaloWrapper_t&>()
+                                       .stencil_operator(
+                                         std::declval<const StencilSpecT&>()));
+
+public:
+  /**
+   * Constructor that takes both matrices, the \ref HaloUpdateMode, a
+   * \ref GlobalBoundarySpec and the \ref StencilSpec used for all steps.
+   * The first matrix is the source of the first step.
+   */
+  HaloDoubleBuffer(MatrixT& first, MatrixT& second, HaloUpdateMode mode,
+                   const GlobBoundSpec_t& bound_spec,
+                   const StencilSpecT&    stencil_spec)
+  : _halo_first(first, mode, bound_spec, stencil_spec),
+    _halo_second(second, mode, bound_spec, stencil_spec),
+    _op_first(_halo_first.stencil_operator(stencil_spec)),
+    _op_second(_halo_second.stencil_operator(stencil_spec)) {}
+
+  /**
+   * Constructor that takes both matrices, a \ref GlobalBoundarySpec and the
+   * \ref StencilSpec used for all steps. Halo regions are pulled.
+   */
+  HaloDoubleBuffer(MatrixT& first, MatrixT& second,
+                   const GlobBoundSpec_t& bound_spec,
+                   const StencilSpecT&    stencil_spec)
+  : HaloDoubleBuffer(first, second, HaloUpdateMode::PULL, bound_spec,
+                     stencil_spec) {}
+
+  HaloDoubleBuffer(const HaloDoubleBuffer&) = delete;
+  HaloDoubleBuffer& operator=(const HaloDoubleBuffer&) = delete;
+
+  /**
+   * Returns the \ref HaloMatrixWrapper of the matrix holding the current
+   * values, the source of the next step.
+   */
+  HaloWrapper_t& halo() { return _swapped ? _halo_second : _halo_first; }
+
+  /**
+   * Returns the \ref HaloMatrixWrapper of the destination of the next step.
+   */
+  HaloWrapper_t& halo_dst() { return _swapped ? _halo_first : _halo_second; }
+
+  /**
+   * Returns the \ref StencilOperator of the source of the next step.
+   */
+  StencilOperator_t& stencil_operator() {
+    return _swapped ? _op_second : _op_first;
+  }
+
+  /**
+   * Returns the matrix holding the current values.
+   */
+  MatrixT& matrix() { return halo().matrix(); }
+
+  /**
+   * Exchanges source and destination.
+   */
+  void swap() { _swapped = !_swapped; }
+
+private:
+  HaloWrapper_t     _halo_first;
+  HaloWrapper_t     _halo_second;
+  StencilOperator_t _op_first;
+  StencilOperator_t _op_second;
+  bool              _swapped = false;
+};
+
+/**
+ * Computes one stencil step with overlapping halo communication.
+ *
+ * The halo update is started asynchronously and the inner elements are
+ * computed meanwhile. Every boundary view of the \ref StencilOperator is
+ * computed as soon as all halo regions accessed by its elements are
+ * updated, the halo regions are polled without blocking. The kernel is
+ * called with a \ref StencilIterator for every element and returns the new
+ * value of the element:
+ *
+ *     auto kernel = [](auto& it) {
+ *       return 0.5 * *it + 0.125 * (it.value_at(0) + it.value_at(1)
+ *                                   + it.value_at(2) + it.value_at(3));
+ *     };
+ *
+ * \param halo       wrapper of the source matrix
+ * \param op         stencil operator created by \c halo
+ * \param begin_dst  local destination memory, same layout as the local
+ *                   memory of the source matrix
+ * \param kernel     computes the new value of an element
+ */
+template <typename MatrixT, typename StencilOpT, typename KernelT>
+void stencil_step(HaloMatrixWrapper<MatrixT>& halo, StencilOpT& op,
+                  typename HaloMatrixWrapper<MatrixT>::Element_t* begin_dst,
+                  KernelT kernel) {
+  using region_index_t = typename HaloMatrixWrapper<MatrixT>::region_index_t;
+
+  static constexpr auto NumDimensions = MatrixT::ndim();
+
+  struct BoundaryView {
+    dim_t                       dim;
+    RegionPos                   pos;
+    std::vector<region_index_t> regions;
+  };
+
+  halo.update_async();
+
+  const auto&               bnd_views = op.spec_views().boundary_views();
+  std::vector<BoundaryView> pending;
+  pending.reserve(NumDimensions * 2);
+  for(dim_t d = 0; d < NumDimensions; ++d) {
+    for(auto pos : { RegionPos::PRE, RegionPos::POST }) {
+      const auto& view = bnd_views[2 * d + static_cast<int>(pos)];
+      if(view.size() == 0)
+        continue;
+
+      pending.push_back(BoundaryView{
+        d, pos,
+        internal::accessed_halo_regions(view, op.view_local(),
+                                        op.stencil_spec()) });
+    }
+  }
+
+  auto iend = op.inner.end();
+  for(auto it = op.inner.begin(); it != iend; ++it) {
+    begin_dst[it.lpos()] = kernel(it);
+  }
+
+  while(!pending.empty()) {
+    auto it_ready = std::find_if(
+      pending.begin(), pending.end(), [&halo](const BoundaryView& bnd) {
+        return std::all_of(
+          bnd.regions.begin(), bnd.regions.end(),
+          [&halo](region_index_t index) { return halo.test(index); });
+      });
+    if(it_ready == pending.end())
+      continue;
+
+    auto range = op.boundary.iterator_at(it_ready->dim, it_ready->pos);
+    for(auto it = range.first; it != range.second; ++it) {
+      begin_dst[it.lpos()] = kernel(it);
+    }
+    pending.erase(it_ready);
+  }
+
+  // completes the pushes and outstanding handles
+  halo.wait();
+}
+
+/**
+ * Computes one stencil step from the source into the destination matrix
+ * of the given \ref HaloDoubleBuffer with overlapping halo communication
+ * (see \ref stencil_step) and exchanges source and destination afterwards.
+ *
+ * In pull mode, the step ends with a barrier as neighbors read the
+ * boundaries of the source matrix, which is overwritten by the next step.
+ */
+template <typename MatrixT, typename StencilSpecT, typename KernelT>
+void stencil_step(HaloDoubleBuffer<MatrixT, StencilSpecT>& buffer,
+                  KernelT                                  kernel) {
+  auto& halo = buffer.halo();
+  stencil_step(halo, buffer.stencil_operator(),
+               buffer.halo_dst().matrix().lbegin(), kernel);
+  if(halo.update_mode() == HaloUpdateMode::PULL)
+    halo.matrix().team().barrier();
+
+  buffer.swap();
+}
+
+}  // namespace halo
+
+}  // namespace dash
+
+#endif  // DASH__HALO_STENCILSTEP_H
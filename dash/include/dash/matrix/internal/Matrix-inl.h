@@ -85,6 +85,7 @@ template <
 inline Matrix<T, NumDim, IndexT, PatternT, LocalMemT>::Matrix(self_t&& other)
   : _team(other._team)
   , _size(other._size)
+  , _lsize(other._lsize)
   , _lcapacity(other._lcapacity)
   , _begin(other._begin)
   , _pattern(other._pattern)
@@ -100,6 +101,12 @@ inline Matrix<T, NumDim, IndexT, PatternT, LocalMemT>::Matrix(self_t&& other)
   other._lend   = nullptr;
   other._begin  = iterator{};
 
+  // Global iterators and views reference the pattern and memory of this
+  // instance:
+  _begin        = iterator(&_glob_mem, _pattern);
+  _ref._refview = MatrixRefView_t(this);
+  local         = local_type(this);
+
   // Register team deallocator:
   _team->register_deallocator(this, std::bind(&Matrix::deallocate, this));
   DASH_LOG_TRACE("Matrix()", "Move-Constructed");
@@ -142,11 +149,19 @@ Matrix<T, NumDim, IndexT, PatternT, LocalMemT>
 
   _team      = other._team;
   _size      = other._size;
+  _lsize     = other._lsize;
   _lcapacity = other._lcapacity;
-  _begin     = other._begin;
   _lbegin    = other._lbegin;
   _lend      = other._lend;
-  _ref       = other._ref;
+  // Global iterators and views reference the pattern and memory of this
+  // instance:
+  _begin        = iterator(&_glob_mem, _pattern);
+  _ref._refview = MatrixRefView_t(this);
+  local         = local_type(this);
+
+  other._lbegin = nullptr;
+  other._lend   = nullptr;
+  other._begin  = iterator{};
 
   // Re-register team deallocator:
   _team->register_deallocator(this, std::bind(&Matrix::deallocate, this));
@@ -254,6 +269,20 @@ bool Matrix<T, NumDim, IndexT, PatternT, LocalMemT>
   return true;
 }
 
+template <typename T, dim_t NumDim, typename IndexT, class PatternT, typename LocalMemT>
+void Matrix<T, NumDim, IndexT, PatternT, LocalMemT>
+::redistribute(
+  const PatternT & pattern)
+{
+  DASH_LOG_TRACE("Matrix.redistribute()");
+  DASH_ASSERT_MSG(pattern.extents() == _pattern.extents(),
+                  "Matrix.redistribute: pattern extents do not match");
+  self_t redist(pattern);
+  dash::copy(begin(), end(), redist.begin());
+  *this = std::move(redist);
+  DASH_LOG_TRACE("Matrix.redistribute >", "lsize:", _lsize);
+}
+
 template <typename T, dim_t NumDim, typename IndexT, class PatternT, typename LocalMemT>
 bool Matrix<T, NumDim, IndexT, PatternT, LocalMemT>
 ::allocate(
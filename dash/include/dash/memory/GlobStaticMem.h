@@ -73,6 +73,33 @@ template <class MSpaceDomainCategory, class MSpaceTypeCategory>
 inline MemorySpace<MSpaceDomainCategory, MSpaceTypeCategory>*
 get_default_memory_space();
 
+namespace detail {
+
+/// Local memory space instance used if none is specified: the instance
+/// provided by the memory space type, if any, or the default memory space
+/// of its memory type.
+template <class LMemSpace>
+inline auto default_local_memory_space(int)
+    -> decltype(LMemSpace::instance())
+{
+  return LMemSpace::instance();
+}
+
+template <class LMemSpace>
+inline MemorySpace<
+    memory_domain_local,
+    typename dash::memory_space_traits<
+        LMemSpace>::memory_space_type_category>*
+default_local_memory_space(long)
+{
+  return get_default_memory_space<
+      memory_domain_local,
+      typename dash::memory_space_traits<
+          LMemSpace>::memory_space_type_category>();
+}
+
+}  // namespace detail
+
 /**
  * Global memory with address space of static size.
  *
@@ -276,10 +303,8 @@ inline GlobStaticMem<LMemSpace>::GlobStaticMem(
     LMemSpace* r, dash::Team const& team)
   : m_team(&team)
   , m_local_allocator(
-        r ? r
-          : get_default_memory_space<
-                memory_domain_local,
-                typename memory_traits::memory_space_type_category>())
+        r ? static_cast<std::pmr::memory_resource*>(r)
+          : detail::default_local_memory_space<LMemSpace>(0))
   , m_local_sizes(std::max(team.size(), std::size_t(1)))
 {
   DASH_LOG_DEBUG("< MemorySpace.MemorySpace");
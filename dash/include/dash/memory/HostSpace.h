@@ -3,8 +3,33 @@
 
 #include <dash/memory/MemorySpaceBase.h>
 
+#include <cstdint>
+
 namespace dash {
 
+/**
+ * Placement policies of local memory in the NUMA domains of a node.
+ */
+enum class numa_policy : uint8_t {
+  /// Keep the placement of the operating system: pages are placed in the
+  /// NUMA domain of the thread touching them first
+  first_touch,
+
+  /// Place pages in the NUMA domain of the allocating unit
+  local,
+
+  /// Interleave pages across all NUMA domains available to the unit
+  interleaved,
+
+  /// Place pages in a specified NUMA domain
+  bind,
+
+  /// Place pages in the NUMA domains of the threads that process them in
+  /// a parallel loop with static schedule, as if they had been touched
+  /// first in such a loop
+  first_touch_parallel
+};
+
 class HostSpace
   : public dash::MemorySpace<memory_domain_local, memory_space_host_tag> {
 public:
@@ -19,11 +44,75 @@ public:
   HostSpace& operator=(HostSpace&& other) = default;
   ~HostSpace()                            = default;
 
+  /**
+   * Creates a host memory space placing allocated memory in NUMA domains
+   * according to the specified policy.
+   *
+   * \param policy   The NUMA placement policy
+   * \param numa_id  The NUMA domain for \c numa_policy::bind
+   */
+  explicit HostSpace(numa_policy policy, int numa_id = -1)
+    : m_policy(policy)
+    , m_numa_id(numa_id)
+  {
+  }
+
+  constexpr numa_policy policy() const noexcept
+  {
+    return m_policy;
+  }
+
+  constexpr int numa_id() const noexcept
+  {
+    return m_numa_id;
+  }
+
+  /**
+   * Applies the NUMA placement policy of this memory space to a local
+   * memory range, e.g. the local portion of a collective allocation.
+   */
+  void place(void* p, size_t bytes) const;
+
 protected:
   void* do_allocate(size_t bytes, size_t alignment) override;
   void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
   bool  do_is_equal(std::pmr::memory_resource const& other) const
       noexcept override;
+
+private:
+  numa_policy m_policy{numa_policy::first_touch};
+  int         m_numa_id{-1};
+};
+
+/**
+ * Host memory space with a NUMA placement policy specified at compile
+ * time, allowing to select the placement of a container's local memory by
+ * its memory space type:
+ *
+ * \code
+ *   dash::Array<double, dash::default_index_t,
+ *               dash::BlockPattern<1>,
+ *               dash::NUMAHostSpace<dash::numa_policy::interleaved> >
+ *     array(size);
+ * \endcode
+ */
+template <numa_policy Policy, int NumaId = -1>
+class NUMAHostSpace : public HostSpace {
+public:
+  NUMAHostSpace()
+    : HostSpace(Policy, NumaId)
+  {
+  }
+
+  /**
+   * The instance used by global memory spaces which are not constructed
+   * with an explicit local memory space.
+   */
+  static NUMAHostSpace* instance()
+  {
+    static NUMAHostSpace space_singleton;
+    return &space_singleton;
+  }
 };
 
 }  // namespace dash
@@ -54,8 +54,16 @@ public:
 
 public:
 
+  /**
+   * Number of nodes in the global team.
+   *
+   * Locality information is resolved on first call.
+   */
   static inline int NumNodes()
   {
+    if (_team_loc == nullptr) {
+      init();
+    }
     return (_team_loc == nullptr)
 //         ? -1 : std::max<int>(_team_loc->num_nodes, 1);
            ? -1 : std::max<int>(_team_loc->num_domains, 1);
@@ -65,6 +73,12 @@ public:
 private:
   static void init();
 
+  static inline void reset()
+  {
+    _unit_loc = nullptr;
+    _team_loc = nullptr;
+  }
+
 private:
   static dart_unit_locality_t     * _unit_loc;
   static dart_domain_locality_t   * _team_loc;
@@ -251,6 +251,15 @@ public:
                     64);
   }
 
+  /**
+   * Size of the cache at the given level in bytes, -1 if unknown.
+   */
+  inline int cache_size(int cache_level)
+  {
+    return (_unit_locality == nullptr)
+           ? -1 : _unit_locality->hwinfo.cache_sizes[cache_level];
+  }
+
   inline std::string hostname()
   {
     return (_unit_locality == nullptr) ? "" : _unit_locality->hwinfo.host;
@@ -53,7 +53,9 @@ namespace dash {
 
 #include <dash/Pattern.h>
 
+#include <dash/halo/HaloMatrixGroup.h>
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/StencilStep.h>
 
 #include <dash/util/BenchmarkParams.h>
 #include <dash/util/Config.h>
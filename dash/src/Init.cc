@@ -66,8 +66,9 @@ void dash::init(int * argc, char ** *argv)
     dash::barrier();
   }
 
-  DASH_LOG_DEBUG("dash::init", "dash::util::Locality::init()");
-  dash::util::Locality::init();
+  // Locality information is created on first use, see
+  // dash::util::Locality::NumNodes and dart_domain_team_locality.
+  dash::util::Locality::reset();
   DASH_LOG_DEBUG("dash::init >");
 }
 
@@ -1,8 +1,91 @@
 #include <dash/memory/HostSpace.h>
 
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/util/Config.h>
+
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/if/dart_locality.h>
+
+#include <cstdint>
+#include <unistd.h>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+void dash::HostSpace::place(void* p, size_t bytes) const
+{
+  if (p == nullptr || bytes == 0) {
+    return;
+  }
+  DASH_LOG_TRACE("HostSpace.place(p, bytes)", p, bytes,
+                 "policy:", static_cast<int>(m_policy));
+  switch (m_policy) {
+    case numa_policy::first_touch:
+      break;
+    case numa_policy::local:
+      dart_mem_place(p, bytes, DART_MEM_PLACE_LOCAL, -1);
+      break;
+    case numa_policy::interleaved:
+      dart_mem_place(p, bytes, DART_MEM_PLACE_INTERLEAVED, -1);
+      break;
+    case numa_policy::bind:
+      if (dart_mem_place(p, bytes, DART_MEM_PLACE_BIND, m_numa_id)
+          != DART_OK) {
+        DASH_LOG_ERROR("HostSpace.place", "invalid NUMA domain", m_numa_id);
+      }
+      break;
+    case numa_policy::first_touch_parallel: {
+#ifdef DASH_ENABLE_OPENMP
+      // Local allocations are not collective, use the hardware locality
+      // of this unit instead of dash::util::UnitLocality:
+      const dart_hwinfo_t * hwinfo;
+      DASH_ASSERT_RETURNS(dart_unit_hwinfo(&hwinfo), DART_OK);
+      auto n_threads = dash::util::Config::get<bool>("DASH_MAX_SMT")
+                         ? hwinfo->max_threads
+                         : hwinfo->min_threads;
+      if (n_threads > 1) {
+        // Every thread moves the chunk it would process in a loop with
+        // static schedule to its NUMA domain:
+        uintptr_t page_size = sysconf(_SC_PAGESIZE);
+        uintptr_t begin     = reinterpret_cast<uintptr_t>(p);
+        #pragma omp parallel num_threads(n_threads)
+        {
+          size_t    n_chunks = omp_get_num_threads();
+          size_t    chunk    = omp_get_thread_num();
+          // Inner chunk boundaries rounded to pages so no page is
+          // skipped, the range boundaries are not rounded as partial
+          // pages may belong to other allocations:
+          uintptr_t c_begin  = (begin + (bytes * chunk) / n_chunks)
+                               & ~(page_size - 1);
+          uintptr_t c_end    = (begin + (bytes * (chunk + 1)) / n_chunks)
+                               & ~(page_size - 1);
+          if (chunk == 0) {
+            c_begin = begin;
+          }
+          if (chunk + 1 == n_chunks) {
+            c_end = begin + bytes;
+          }
+          if (c_begin < c_end) {
+            dart_mem_place(reinterpret_cast<void *>(c_begin),
+                           c_end - c_begin, DART_MEM_PLACE_LOCAL, -1);
+          }
+        }
+        break;
+      }
+#endif
+      dart_mem_place(p, bytes, DART_MEM_PLACE_LOCAL, -1);
+      break;
+    }
+  }
+}
+
 void * dash::HostSpace::do_allocate(size_t bytes, size_t alignment)
 {
-  return std::pmr::get_default_resource()->allocate(bytes, alignment);
+  void * p = std::pmr::get_default_resource()->allocate(bytes, alignment);
+  place(p, bytes);
+  return p;
 }
 void dash::HostSpace::do_deallocate(void* p, size_t bytes, size_t alignment)
 {
@@ -2,6 +2,7 @@
 #define DASH__TEST__TEST_BASE_H_
 
 #include <type_traits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -13,6 +14,7 @@
 #include <dash/Team.h>
 #include <dash/Types.h>
 #include <dash/view/IndexSet.h>
+#include <dash/algorithm/Copy.h>
 
 #include "TestGlobals.h"
 #include "TestLogHelpers.h"
@@ -270,6 +272,20 @@ static bool expect_range_values_equal(
   return (end_a == it_a) && (end_b == it_b);
 }
 
+/**
+ * Copies the elements of the global range to a local vector.
+ */
+template <class GlobIter>
+static std::vector<typename GlobIter::value_type> copy_range(
+  GlobIter begin,
+  GlobIter end)
+{
+  std::vector<typename GlobIter::value_type> values(
+    dash::distance(begin, end));
+  dash::copy(begin, end, values.data());
+  return values;
+}
+
 class TestBase : public ::testing::Test {
 
  protected:
@@ -284,6 +300,9 @@ class TestBase : public ::testing::Test {
      dash::init(&TESTENV::argc, &TESTENV::argv);
 
      LOG_MESSAGE("-==- DASH initialized with %lu units", dash::size());
+     // Locality of a team is exchanged collectively on first use, tests
+     // query it at single units (see DASH_TEST_LOCAL_ONLY):
+     ASSERT_EQ(DART_OK, dart_team_locality_init(DART_TEAM_ALL));
      dash::barrier();
   }
 
@@ -893,6 +893,180 @@ TEST_F(CopyTest, AsyncGlobalToLocalTest)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToGlobal)
+{
+  const int num_elem_per_unit = 23;
+  size_t num_elem_total       = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKED);
+  dash::Array<int> dst(num_elem_total + 7, dash::BLOCKCYCLIC(3));
+
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = static_cast<int>(src.pattern().global(l));
+  }
+  std::fill(dst.lbegin(), dst.lend(), -1);
+  dash::barrier();
+
+  // Copy all but the first and last two elements to an offset of 5 in the
+  // destination, so both ranges start and end within blocks:
+  auto out_last = dash::copy(src.begin() + 1, src.end() - 2,
+                             dst.begin() + 5);
+  EXPECT_EQ_U(static_cast<long>(num_elem_total - 3) + 5, out_last.pos());
+
+  for (size_t l = 0; l < dst.lsize(); ++l) {
+    auto g_idx = static_cast<long>(dst.pattern().global(l));
+    auto s_idx = g_idx - 4;
+    int expected = (g_idx < 5 || s_idx >= static_cast<long>(num_elem_total) - 2)
+                   ? -1
+                   : static_cast<int>(s_idx);
+    EXPECT_EQ_U(expected, dst.local[l]);
+  }
+  dash::barrier();
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobal)
+{
+  const int num_elem_per_unit = 17;
+  size_t num_elem_total       = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKCYCLIC(4));
+  dash::Array<int> dst(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = static_cast<int>(src.pattern().global(l)) * 3;
+  }
+  dash::barrier();
+
+  auto fut = dash::copy_async(src.begin(), src.end(), dst.begin());
+  auto out_last = fut.get();
+  EXPECT_EQ_U(dst.end(), out_last);
+  // The output range is complete once all units completed their transfers:
+  dash::barrier();
+
+  for (size_t l = 0; l < dst.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<int>(dst.pattern().global(l)) * 3,
+                dst.local[l]);
+  }
+  dash::barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalMatrix)
+{
+  const size_t rows = _dash_size * 5;
+  const size_t cols = _dash_size * 3 + 1;
+
+  dash::Matrix<int, 2> src(
+    dash::SizeSpec<2>(rows, cols),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+  dash::Matrix<int, 2> dst(
+    dash::SizeSpec<2>(rows, cols),
+    dash::DistributionSpec<2>(dash::NONE, dash::BLOCKCYCLIC(2)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(1, _dash_size));
+
+  if (_dash_id == 0) {
+    for (size_t row = 0; row < rows; ++row) {
+      for (size_t col = 0; col < cols; ++col) {
+        src[row][col] = static_cast<int>(row * cols + col);
+      }
+    }
+  }
+  src.barrier();
+
+  auto out_last = dash::copy(src.begin(), src.end(), dst.begin());
+  EXPECT_EQ_U(dst.end(), out_last);
+
+  if (_dash_id == 0) {
+    for (size_t row = 0; row < rows; ++row) {
+      for (size_t col = 0; col < cols; ++col) {
+        EXPECT_EQ_U(static_cast<int>(row * cols + col),
+                    static_cast<int>(dst[row][col]));
+      }
+    }
+  }
+  dst.barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalTiles)
+{
+  typedef dash::TilePattern<2>          src_pattern_t;
+  typedef dash::Pattern<2>              dst_pattern_t;
+  typedef src_pattern_t::index_type     index_t;
+
+  const size_t rows = _dash_size * 4;
+  const size_t cols = 6;
+
+  // Tiles are contiguous in the global index space of src, blocks of dst
+  // are split in rows:
+  dash::Matrix<int, 2, index_t, src_pattern_t> src(
+    dash::SizeSpec<2>(rows, cols),
+    dash::DistributionSpec<2>(dash::TILE(2), dash::TILE(3)));
+  dash::Matrix<int, 2, index_t, dst_pattern_t> dst(
+    dash::SizeSpec<2>(rows, cols),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKCYCLIC(4)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(1, _dash_size));
+
+  for (size_t l = 0; l < src.local.size(); ++l) {
+    src.lbegin()[l] = static_cast<int>(src.pattern().global(l));
+  }
+  std::fill(dst.lbegin(), dst.lend(), -1);
+  src.barrier();
+
+  // Copy all but the first and last element, elements are copied in the
+  // order of global indices:
+  dash::copy(src.begin() + 1, src.end() - 1, dst.begin() + 1);
+  dst.barrier();
+
+  auto size = static_cast<index_t>(rows * cols);
+  for (size_t l = 0; l < dst.local.size(); ++l) {
+    auto g_idx   = dst.pattern().global(l);
+    int expected = (g_idx == 0 || g_idx == size - 1)
+                   ? -1
+                   : static_cast<int>(g_idx);
+    EXPECT_EQ_U(expected, dst.lbegin()[l]);
+  }
+  dst.barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalBlockView)
+{
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t tilesize_row = 3;
+  const size_t tilesize_col = 4;
+  typedef dash::TilePattern<2> pattern_t;
+
+  dash::Matrix<int, 2, pattern_t::index_type, pattern_t> src(
+    dash::SizeSpec<2>(tilesize_row * _dash_size, tilesize_col * 2),
+    dash::DistributionSpec<2>(dash::TILE(tilesize_row),
+                              dash::TILE(tilesize_col)));
+  dash::Matrix<int, 2, pattern_t::index_type, pattern_t> dst(
+    src.pattern().sizespec(), src.pattern().distspec());
+
+  for (size_t l = 0; l < src.local.size(); ++l) {
+    src.lbegin()[l] = static_cast<int>(src.pattern().global(l));
+  }
+  std::fill(dst.lbegin(), dst.lend(), -1);
+  src.barrier();
+
+  // Copy block 1 of src to block 0 of dst:
+  dash::copy(src.block(1).begin(), src.block(1).end(), dst.block(0).begin());
+
+  if (_dash_id == 0) {
+    auto block_src = src.block(1);
+    auto block_dst = dst.block(0);
+    for (size_t row = 0; row < tilesize_row; ++row) {
+      for (size_t col = 0; col < tilesize_col; ++col) {
+        EXPECT_EQ_U(static_cast<int>(block_src[row][col]),
+                    static_cast<int>(block_dst[row][col]));
+      }
+    }
+  }
+  dst.barrier();
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
@@ -0,0 +1,105 @@
+
+#include "GatherScatterTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/GatherScatter.h>
+
+#include <vector>
+
+
+TEST_F(GatherScatterTest, GatherRandomIndices)
+{
+  typedef int64_t value_t;
+
+  auto   myid   = dash::myid().id;
+  size_t nunits = dash::size();
+  size_t n      = 17 * nunits;
+
+  dash::Array<value_t> array(n, dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = 10 * array.pattern().global(l);
+  }
+  array.barrier();
+
+  // Pseudo-random indices with duplicates, last unit requests none:
+  std::vector<size_t> indices;
+  if (nunits == 1 || static_cast<size_t>(myid) != nunits - 1) {
+    size_t idx = myid;
+    for (int i = 0; i < 50; ++i) {
+      idx = (idx * 31 + 7) % n;
+      indices.push_back(idx);
+    }
+  }
+  std::vector<value_t> values(indices.size(), -1);
+  auto out_end = dash::gather(
+                   array, indices.begin(), indices.end(), values.begin());
+  EXPECT_EQ_U(values.end(), out_end);
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ_U(10 * static_cast<value_t>(indices[i]), values[i]);
+  }
+}
+
+TEST_F(GatherScatterTest, ScatterDisjointIndices)
+{
+  typedef double value_t;
+
+  auto   myid   = dash::myid().id;
+  size_t nunits = dash::size();
+  size_t n      = 13 * nunits;
+
+  dash::Array<value_t> array(n);
+  std::fill(array.lbegin(), array.lend(), -1.0);
+  array.barrier();
+
+  // Every unit assigns elements i with i % nunits == myid, in descending
+  // order:
+  std::vector<size_t>  indices;
+  std::vector<value_t> values;
+  for (size_t i = n; i-- > 0; ) {
+    if (i % nunits == static_cast<size_t>(myid)) {
+      indices.push_back(i);
+      values.push_back(i + 0.5);
+    }
+  }
+  dash::scatter(array, indices.begin(), indices.end(), values.begin());
+
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ_U(i + 0.5, static_cast<value_t>(array[i]));
+  }
+}
+
+TEST_F(GatherScatterTest, ScatterAccumulateHistogram)
+{
+  typedef int64_t value_t;
+
+  size_t nunits = dash::size();
+  size_t n      = 11 * nunits;
+  size_t nbins  = 3 * n;
+
+  dash::Array<value_t> hist(n);
+  std::fill(hist.lbegin(), hist.lend(), 0);
+  hist.barrier();
+
+  auto bin_index = [&](size_t unit, size_t k) {
+    return (unit * 7 + k * k) % n;
+  };
+  std::vector<size_t>  indices;
+  std::vector<value_t> ones;
+  for (size_t k = 0; k < nbins; ++k) {
+    indices.push_back(bin_index(dash::myid().id, k));
+    ones.push_back(1);
+  }
+  dash::scatter_accumulate(
+    hist, indices.begin(), indices.end(), ones.begin(),
+    dash::plus<value_t>());
+
+  std::vector<value_t> expected(n, 0);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t k = 0; k < nbins; ++k) {
+      ++expected[bin_index(u, k)];
+    }
+  }
+  for (size_t l = 0; l < hist.lsize(); ++l) {
+    EXPECT_EQ_U(expected[hist.pattern().global(l)], hist.local[l]);
+  }
+}
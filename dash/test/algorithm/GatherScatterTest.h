@@ -0,0 +1,13 @@
+#ifndef DASH__TEST__GATHER_SCATTER_TEST_H_
+#define DASH__TEST__GATHER_SCATTER_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::gather, dash::scatter and
+ * dash::scatter_accumulate.
+ */
+class GatherScatterTest : public dash::test::TestBase {
+};
+
+#endif  // DASH__TEST__GATHER_SCATTER_TEST_H_
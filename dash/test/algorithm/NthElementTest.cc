@@ -0,0 +1,115 @@
+
+#include "NthElementTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/NthElement.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+TEST_F(NthElementTest, MedianAndPercentiles)
+{
+  typedef int64_t value_t;
+
+  size_t n = num_local_elem * dash::size() + 3;
+  dash::Array<value_t> array(n);
+
+  // Keys with many duplicates and a skewed distribution:
+  std::mt19937 generator(dash::myid());
+  std::geometric_distribution<value_t> distribution(0.01);
+  for (auto & v : array.local) {
+    v = distribution(generator) - 50;
+  }
+  array.barrier();
+
+  auto sorted = dash::test::copy_range(array.begin(), array.end());
+  std::sort(sorted.begin(), sorted.end());
+  array.barrier();
+
+  for (size_t rank : { n / 2, n / 100, n - 1, size_t(0) }) {
+    dash::nth_element(array.begin(), array.begin() + rank, array.end());
+
+    auto values = dash::test::copy_range(array.begin(), array.end());
+    EXPECT_EQ_U(sorted[rank], values[rank]);
+    for (size_t i = 0; i < rank; ++i) {
+      EXPECT_LE_U(values[i], values[rank]);
+    }
+    for (size_t i = rank + 1; i < n; ++i) {
+      EXPECT_GE_U(values[i], values[rank]);
+    }
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ_U(sorted, values);
+    array.barrier();
+  }
+}
+
+TEST_F(NthElementTest, PartialSortSmallest)
+{
+  typedef double value_t;
+
+  size_t n = num_local_elem * dash::size();
+  dash::Array<value_t> array(n);
+
+  std::mt19937 generator(dash::myid());
+  std::uniform_real_distribution<value_t> distribution(-1.0, 1.0);
+  for (auto & v : array.local) {
+    v = distribution(generator);
+  }
+  array.barrier();
+
+  auto sorted = dash::test::copy_range(array.begin(), array.end());
+  std::sort(sorted.begin(), sorted.end());
+  array.barrier();
+
+  size_t k = 37 + dash::size();
+  dash::partial_sort(array.begin(), array.begin() + k, array.end());
+
+  auto values = dash::test::copy_range(array.begin(), array.end());
+  for (size_t i = 0; i < k; ++i) {
+    EXPECT_EQ_U(sorted[i], values[i]);
+  }
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ_U(sorted, values);
+}
+
+TEST_F(NthElementTest, TopKLargest)
+{
+  struct item_t {
+    int32_t key;
+    int64_t pos;
+  };
+
+  size_t n = num_local_elem * dash::size();
+  dash::Array<item_t> array(n);
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int64_t g = array.pattern().global(l);
+    array.local[l] = item_t { static_cast<int32_t>((g * 7919) % 1000), g };
+  }
+  array.barrier();
+
+  auto key_of   = [](const item_t & item) { return item.key; };
+  auto expected = dash::test::copy_range(array.begin(), array.end());
+  std::stable_sort(
+    expected.begin(), expected.end(),
+    [](const item_t & a, const item_t & b) { return b.key < a.key; });
+  array.barrier();
+
+  size_t k = 3 * dash::size() + 50;
+  std::vector<item_t> top(k);
+  auto out_end = dash::top_k(array.begin(), array.end(), k, top.begin(),
+                             key_of);
+  EXPECT_EQ_U(top.end(), out_end);
+  for (size_t i = 0; i < k; ++i) {
+    EXPECT_EQ_U(expected[i].key, top[i].key);
+    EXPECT_EQ_U(expected[i].pos, top[i].pos);
+  }
+  // The range is not modified:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(array.pattern().global(l), array.local[l].pos);
+  }
+}
@@ -0,0 +1,108 @@
+
+#include "PartitionTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/Partition.h>
+
+#include <algorithm>
+#include <vector>
+
+
+TEST_F(PartitionTest, CopyIfToArray)
+{
+  typedef int64_t value_t;
+
+  size_t n = num_local_elem * dash::size() + 3;
+  dash::Array<value_t> src(n);
+  dash::Array<value_t> dst(n);
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = (src.pattern().global(l) * 7919) % 1013;
+  }
+  std::fill(dst.lbegin(), dst.lend(), -1);
+  src.barrier();
+
+  auto pred     = [](value_t v) { return v % 3 == 0; };
+  auto values   = dash::test::copy_range(src.begin(), src.end());
+  std::vector<value_t> expected;
+  std::copy_if(values.begin(), values.end(), std::back_inserter(expected),
+               pred);
+  src.barrier();
+
+  auto dst_end = dash::copy_if(src.begin(), src.end(), dst.begin(), pred);
+  ASSERT_EQ_U(expected.size(), dash::distance(dst.begin(), dst_end));
+
+  auto result = dash::test::copy_range(dst.begin(), dst.end());
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ_U(i < expected.size() ? expected[i] : -1, result[i]);
+  }
+}
+
+TEST_F(PartitionTest, RemoveIfInPlace)
+{
+  typedef int32_t value_t;
+
+  size_t n = num_local_elem * dash::size();
+  dash::Array<value_t> array(n);
+  // The elements of some units are removed completely:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (dash::myid() % 2 == 1)
+                     ? -1
+                     : static_cast<value_t>(array.pattern().global(l));
+  }
+  array.barrier();
+
+  auto pred     = [](value_t v) { return v < 0 || v % 5 == 1; };
+  auto values   = dash::test::copy_range(array.begin(), array.end());
+  values.erase(std::remove_if(values.begin(), values.end(), pred),
+               values.end());
+  array.barrier();
+
+  auto new_end = dash::remove_if(array.begin(), array.end(), pred);
+  ASSERT_EQ_U(values.size(), dash::distance(array.begin(), new_end));
+  EXPECT_EQ_U(values, dash::test::copy_range(array.begin(), new_end));
+}
+
+TEST_F(PartitionTest, PartitionStable)
+{
+  typedef int64_t value_t;
+
+  size_t n = num_local_elem * dash::size() + 1;
+  dash::Array<value_t> array(n);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (array.pattern().global(l) * 37) % 101;
+  }
+  array.barrier();
+
+  auto pred     = [](value_t v) { return v < 30; };
+  auto expected = dash::test::copy_range(array.begin(), array.end());
+  auto mid      = std::stable_partition(expected.begin(), expected.end(),
+                                        pred);
+  array.barrier();
+
+  auto middle = dash::partition(array.begin(), array.end(), pred);
+  EXPECT_EQ_U(mid - expected.begin(), dash::distance(array.begin(), middle));
+  EXPECT_EQ_U(expected, dash::test::copy_range(array.begin(), array.end()));
+}
+
+TEST_F(PartitionTest, UniqueSorted)
+{
+  typedef int32_t value_t;
+
+  size_t n = num_local_elem * dash::size();
+  dash::Array<value_t> array(n);
+  // Sorted values with groups of equal values spanning units:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = static_cast<value_t>(array.pattern().global(l) / 300);
+  }
+  array.barrier();
+
+  auto expected = dash::test::copy_range(array.begin(), array.end());
+  expected.erase(std::unique(expected.begin(), expected.end()),
+                 expected.end());
+  array.barrier();
+
+  auto new_end = dash::unique(array.begin(), array.end());
+  ASSERT_EQ_U(expected.size(), dash::distance(array.begin(), new_end));
+  EXPECT_EQ_U(expected, dash::test::copy_range(array.begin(), new_end));
+}
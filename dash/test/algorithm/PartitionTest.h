@@ -0,0 +1,15 @@
+#ifndef DASH__TEST__PARTITION_TEST_H_
+#define DASH__TEST__PARTITION_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::copy_if, dash::remove_if,
+ * dash::partition and dash::unique.
+ */
+class PartitionTest : public dash::test::TestBase {
+protected:
+  size_t const num_local_elem = 1000;
+};
+
+#endif  // DASH__TEST__PARTITION_TEST_H_
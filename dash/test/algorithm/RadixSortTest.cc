@@ -0,0 +1,135 @@
+
+#include "RadixSortTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/RadixSort.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+/**
+ * Copies the elements of the global range to a local vector.
+ */
+template <class GlobIter>
+static std::vector<typename GlobIter::value_type> copy_range(
+  GlobIter begin,
+  GlobIter end)
+{
+  std::vector<typename GlobIter::value_type> values(
+    dash::distance(begin, end));
+  dash::copy(begin, end, values.data());
+  return values;
+}
+
+TEST_F(RadixSortTest, Int64Keys)
+{
+  typedef int64_t value_t;
+
+  dash::Array<value_t> array(num_local_elem * dash::size());
+
+  std::mt19937_64 generator(dash::myid());
+  std::uniform_int_distribution<value_t> distribution(
+    std::numeric_limits<value_t>::min(), std::numeric_limits<value_t>::max());
+  for (auto & v : array.local) {
+    v = distribution(generator);
+  }
+  array.local[0] = std::numeric_limits<value_t>::min();
+  array.local[1] = std::numeric_limits<value_t>::max();
+  array.local[2] = 0;
+  array.local[3] = -1;
+  array.barrier();
+
+  auto expected = copy_range(array.begin(), array.end());
+  std::sort(expected.begin(), expected.end());
+  array.barrier();
+
+  dash::radix_sort(array.begin(), array.end());
+
+  EXPECT_EQ_U(expected, copy_range(array.begin(), array.end()));
+}
+
+TEST_F(RadixSortTest, DoubleKeys)
+{
+  typedef double value_t;
+
+  // Unequal local sizes:
+  dash::Array<value_t> array(num_local_elem * dash::size() + 7);
+
+  std::mt19937 generator(dash::myid());
+  std::uniform_real_distribution<value_t> distribution(-1.0e3, 1.0e3);
+  for (auto & v : array.local) {
+    v = distribution(generator);
+  }
+  array.local[0] = -std::numeric_limits<value_t>::infinity();
+  array.local[1] = std::numeric_limits<value_t>::max();
+  array.local[2] = -0.5;
+  array.local[3] = 0.0;
+  array.barrier();
+
+  auto expected = copy_range(array.begin(), array.end());
+  std::sort(expected.begin(), expected.end());
+  array.barrier();
+
+  dash::radix_sort(array.begin(), array.end());
+
+  EXPECT_EQ_U(expected, copy_range(array.begin(), array.end()));
+}
+
+TEST_F(RadixSortTest, StableWithHash)
+{
+  struct point_t {
+    int32_t key;
+    int64_t pos;
+  };
+
+  size_t n = num_local_elem * dash::size();
+  dash::Array<point_t> array(n);
+
+  // Few distinct keys, positions in the initial order:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int64_t g = array.pattern().global(l);
+    array.local[l] = point_t { static_cast<int32_t>((g * 7919) % 13) - 6,
+                               g };
+  }
+  array.barrier();
+
+  dash::radix_sort(array.begin(), array.end(),
+                   [](const point_t & p) { return p.key; });
+
+  auto sorted = copy_range(array.begin(), array.end());
+  ASSERT_EQ_U(n, sorted.size());
+  for (size_t i = 1; i < n; ++i) {
+    EXPECT_LE_U(sorted[i - 1].key, sorted[i].key);
+    if (sorted[i - 1].key == sorted[i].key) {
+      EXPECT_LT_U(sorted[i - 1].pos, sorted[i].pos);
+    }
+  }
+}
+
+TEST_F(RadixSortTest, PartialRange)
+{
+  typedef uint32_t value_t;
+
+  size_t n = num_local_elem * dash::size();
+  dash::Array<value_t> array(n);
+
+  std::mt19937 generator(dash::myid());
+  for (auto & v : array.local) {
+    v = generator() % 100000;
+  }
+  array.barrier();
+
+  auto first    = array.begin() + 11;
+  auto last     = array.end() - 5;
+  auto expected = copy_range(array.begin(), array.end());
+  std::sort(expected.begin() + 11, expected.end() - 5);
+  array.barrier();
+
+  dash::radix_sort(first, last);
+
+  EXPECT_EQ_U(expected, copy_range(array.begin(), array.end()));
+}
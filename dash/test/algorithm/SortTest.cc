@@ -430,5 +430,104 @@ TEST_F(SortTest, ExtremValues)
   perform_test(arr.begin(), arr.end());
 }
 
+TEST_F(SortTest, ArrayFullKeyRange)
+{
+  using Element_t = int64_t;
+  using Array_t   = dash::Array<Element_t>;
+
+  Array_t array(num_local_elem * dash::size());
+
+  // Splitter bounds span the whole value range of the key type:
+  std::mt19937_64 generator(dash::myid());
+  for (auto& v : array.local) {
+    v = static_cast<Element_t>(generator());
+  }
+  array.local[0] = std::numeric_limits<Element_t>::min();
+  array.local[1] = std::numeric_limits<Element_t>::max();
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  for (size_t i = 1; i < array.lsize(); ++i) {
+    EXPECT_LE_U(array.local[i - 1], array.local[i]);
+  }
+  auto const gidx0 = array.pattern().global(0);
+  if (gidx0 > 0) {
+    EXPECT_LE_U(static_cast<Element_t>(array[gidx0 - 1]), array.local[0]);
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, ArrayDescendingHash)
+{
+  using Element_t = int32_t;
+  using Array_t   = dash::Array<Element_t>;
+
+  Array_t array(num_local_elem * dash::size());
+  rand_range(array.begin(), array.end());
+  array.barrier();
+
+  // The final merge must order elements by their hash values:
+  dash::sort(
+      array.begin(), array.end(), [](Element_t const& v) { return -v; });
+
+  for (size_t i = 1; i < array.lsize(); ++i) {
+    EXPECT_GE_U(array.local[i - 1], array.local[i]);
+  }
+  auto const gidx0 = array.pattern().global(0);
+  if (gidx0 > 0) {
+    EXPECT_GE_U(static_cast<Element_t>(array[gidx0 - 1]), array.local[0]);
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, MergeSortedRuns)
+{
+  using value_t = int64_t;
+  using run_t   = std::pair<value_t*, value_t*>;
+
+  // Runs of different lengths with duplicates and empty runs:
+  std::vector<std::vector<value_t>> runs_data(7);
+  std::vector<value_t>              expected;
+  for (size_t r = 0; r < runs_data.size(); ++r) {
+    size_t len = (r % 3 == 1) ? 0 : 50 + 37 * r;
+    for (size_t i = 0; i < len; ++i) {
+      runs_data[r].push_back(static_cast<value_t>((i * (r + 2)) / 3));
+    }
+    expected.insert(
+        expected.end(), runs_data[r].begin(), runs_data[r].end());
+  }
+  std::sort(expected.begin(), expected.end());
+
+  for (int nthreads : {1, 2, 5}) {
+    std::vector<run_t> runs;
+    for (auto& run : runs_data) {
+      runs.emplace_back(run.data(), run.data() + run.size());
+    }
+    std::vector<value_t> merged(expected.size(), -1);
+    dash::detail::psort__merge_runs(
+        runs, merged.begin(), std::less<value_t>(), nthreads);
+    EXPECT_EQ_U(expected, merged);
+  }
+}
+
+TEST_F(SortTest, LocalSortChunks)
+{
+  using value_t = int32_t;
+
+  std::vector<value_t> values(10007);
+  std::mt19937         generator(42);
+  std::uniform_int_distribution<value_t> distribution(-500, 500);
+  for (auto& v : values) {
+    v = distribution(generator);
+  }
+  std::vector<value_t> expected(values);
+  std::sort(expected.begin(), expected.end(), std::greater<value_t>());
+
+  dash::detail::psort__local_sort(
+      values.begin(), values.end(), std::greater<value_t>(), 3);
+  EXPECT_TRUE_U(expected == values);
+}
+
 // TODO: add additional unit tests with various pattern types and containers
 //
@@ -0,0 +1,118 @@
+
+#include "TransposeTest.h"
+
+#include <dash/Matrix.h>
+#include <dash/algorithm/Transpose.h>
+
+
+TEST_F(TransposeTest, BlockedNonSquare)
+{
+  const size_t nrows = dash::size() * 7 + 3;
+  const size_t ncols = dash::size() * 5 + 1;
+
+  dash::Matrix<int, 2> src(nrows, ncols);
+  dash::Matrix<int, 2> dst(ncols, nrows);
+
+  if (dash::myid() == 0) {
+    for (size_t row = 0; row < nrows; ++row) {
+      for (size_t col = 0; col < ncols; ++col) {
+        src[row][col] = static_cast<int>(row * ncols + col);
+      }
+    }
+  }
+  src.barrier();
+
+  dash::transpose(src, dst);
+
+  if (dash::myid() == 0) {
+    for (size_t row = 0; row < ncols; ++row) {
+      for (size_t col = 0; col < nrows; ++col) {
+        EXPECT_EQ_U(static_cast<int>(col * ncols + row),
+                    static_cast<int>(dst[row][col]));
+      }
+    }
+  }
+  dst.barrier();
+}
+
+TEST_F(TransposeTest, TiledTransposedPattern)
+{
+  typedef dash::TilePattern<2>                     pattern_t;
+  typedef pattern_t::index_type                    index_t;
+  typedef dash::Matrix<double, 2, index_t, pattern_t> matrix_t;
+
+  const size_t tile_rows = 2;
+  const size_t tile_cols = 3;
+  const size_t nrows     = tile_rows * dash::size() * 3;
+  const size_t ncols     = tile_cols * dash::size() * 2;
+
+  dash::TeamSpec<2> teamspec_src(dash::size(), 1);
+  teamspec_src.balance_extents();
+  dash::TeamSpec<2> teamspec_dst(teamspec_src.extent(1),
+                                 teamspec_src.extent(0));
+
+  matrix_t src(pattern_t(dash::SizeSpec<2>(nrows, ncols),
+                         dash::DistributionSpec<2>(dash::TILE(tile_rows),
+                                                   dash::TILE(tile_cols)),
+                         teamspec_src));
+  matrix_t dst(pattern_t(dash::SizeSpec<2>(ncols, nrows),
+                         dash::DistributionSpec<2>(dash::TILE(tile_cols),
+                                                   dash::TILE(tile_rows)),
+                         teamspec_dst));
+
+  for (index_t lrow = 0; lrow < src.local.extent(0); ++lrow) {
+    for (index_t lcol = 0; lcol < src.local.extent(1); ++lcol) {
+      auto gcoords = src.pattern().global({ lrow, lcol });
+      src.local[lrow][lcol] = gcoords[0] * 1000.0 + gcoords[1];
+    }
+  }
+  src.barrier();
+
+  dash::transpose(src, dst);
+
+  for (index_t lrow = 0; lrow < dst.local.extent(0); ++lrow) {
+    for (index_t lcol = 0; lcol < dst.local.extent(1); ++lcol) {
+      auto gcoords = dst.pattern().global({ lrow, lcol });
+      EXPECT_EQ_U(gcoords[1] * 1000.0 + gcoords[0],
+                  static_cast<double>(dst.local[lrow][lcol]));
+    }
+  }
+  dst.barrier();
+}
+
+TEST_F(TransposeTest, InPlaceSquare)
+{
+  typedef dash::TilePattern<2>                  pattern_t;
+  typedef pattern_t::index_type                 index_t;
+  typedef dash::Matrix<int, 2, index_t, pattern_t> matrix_t;
+
+  const size_t tile = 4;
+  const size_t n    = tile * dash::size() * 2;
+
+  dash::TeamSpec<2> teamspec(dash::size(), 1);
+  teamspec.balance_extents();
+  matrix_t matrix(pattern_t(dash::SizeSpec<2>(n, n),
+                            dash::DistributionSpec<2>(dash::TILE(tile),
+                                                      dash::TILE(tile)),
+                            teamspec));
+  if (dash::myid() == 0) {
+    for (size_t row = 0; row < n; ++row) {
+      for (size_t col = 0; col < n; ++col) {
+        matrix[row][col] = static_cast<int>(row * n + col);
+      }
+    }
+  }
+  matrix.barrier();
+
+  dash::transpose(matrix);
+
+  if (dash::myid() == 0) {
+    for (size_t row = 0; row < n; ++row) {
+      for (size_t col = 0; col < n; ++col) {
+        EXPECT_EQ_U(static_cast<int>(col * n + row),
+                    static_cast<int>(matrix[row][col]));
+      }
+    }
+  }
+  matrix.barrier();
+}
@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__TRANSPOSE_TEST_H_
+#define DASH__TEST__TRANSPOSE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::transpose.
+ */
+class TransposeTest : public dash::test::TestBase {
+};
+
+#endif  // DASH__TEST__TRANSPOSE_TEST_H_
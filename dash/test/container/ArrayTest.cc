@@ -306,6 +306,35 @@ TEST_F(ArrayTest, ElementCompare){
   }
 }
 
+TEST_F(ArrayTest, Redistribute){
+  using array_t   = dash::Array<int>;
+  using pattern_t = array_t::pattern_type;
+
+  const size_t nelem = dash::size() * 37 + 5;
+  array_t arr(nelem, dash::BLOCKED);
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    arr.local[l] = static_cast<int>(arr.pattern().global(l));
+  }
+  arr.barrier();
+
+  arr.redistribute(pattern_t(nelem, dash::BLOCKCYCLIC(4)));
+  EXPECT_EQ_U(nelem, arr.size());
+  EXPECT_EQ_U(arr.pattern().local_size(), arr.lsize());
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<int>(arr.pattern().global(l)), arr.local[l]);
+  }
+  arr.barrier();
+
+  // Rebalance to different block sizes:
+  arr.redistribute(pattern_t(nelem, dash::BLOCKCYCLIC(11)));
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < nelem; ++i) {
+      EXPECT_EQ_U(static_cast<int>(i), static_cast<int>(arr[i]));
+    }
+  }
+  arr.barrier();
+}
+
 TEST_F(ArrayTest, HBWSpace){
   using index_t = dash::default_index_t;
   using pattern_t = dash::BlockPattern<1, dash::ROW_MAJOR, index_t>;
@@ -1570,8 +1570,11 @@ TEST_F(MatrixTest, SubViewMatrix3Dim)
                                         matrix[0].end()));
 
   if (dash::myid().id == 0) {
-  int visited = 0;
-    for (auto it = matrix[0].begin(); it != matrix[0].end();
+    // Iterators reference the view spec of the sub-matrix, the sub-matrix
+    // must outlive them:
+    auto sub_0   = matrix[0];
+    int  visited = 0;
+    for (auto it = sub_0.begin(); it != sub_0.end();
          ++it, ++visited) {
       double val = *it;
     }
@@ -1621,6 +1624,53 @@ TEST_F(MatrixTest, MoveSemantics){
   }
 }
 
+TEST_F(MatrixTest, Redistribute){
+  typedef dash::TilePattern<2>                  pattern_t;
+  typedef pattern_t::index_type                 index_t;
+  typedef dash::Matrix<int, 2, index_t, pattern_t> matrix_t;
+
+  const size_t rows = dash::size() * 6;
+  const size_t cols = dash::size() * 4 + 2;
+
+  dash::TeamSpec<2> teamspec(dash::size(), 1);
+  matrix_t matrix(
+    pattern_t(dash::SizeSpec<2>(rows, cols),
+              dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+              teamspec));
+  if (dash::myid() == 0) {
+    for (size_t row = 0; row < rows; ++row) {
+      for (size_t col = 0; col < cols; ++col) {
+        matrix[row][col] = static_cast<int>(row * cols + col);
+      }
+    }
+  }
+  matrix.barrier();
+
+  teamspec.balance_extents();
+  matrix.redistribute(
+    pattern_t(dash::SizeSpec<2>(rows, cols),
+              dash::DistributionSpec<2>(dash::TILE(2), dash::TILE(3)),
+              teamspec));
+  EXPECT_EQ_U(matrix.pattern().local_size(), matrix.local_size());
+
+  for (index_t lrow = 0; lrow < matrix.local.extent(0); ++lrow) {
+    for (index_t lcol = 0; lcol < matrix.local.extent(1); ++lcol) {
+      auto gcoords = matrix.pattern().global({ lrow, lcol });
+      EXPECT_EQ_U(static_cast<int>(gcoords[0] * cols + gcoords[1]),
+                  static_cast<int>(matrix.local[lrow][lcol]));
+    }
+  }
+  if (dash::myid() == 0) {
+    for (size_t row = 0; row < rows; ++row) {
+      for (size_t col = 0; col < cols; ++col) {
+        EXPECT_EQ_U(static_cast<int>(row * cols + col),
+                    static_cast<int>(matrix[row][col]));
+      }
+    }
+  }
+  matrix.barrier();
+}
+
 // test for issue 532
 TEST_F(MatrixTest, LocalDiagonal){
   dash::TeamSpec<2> ts(dash::size(), 1);
@@ -0,0 +1,161 @@
+
+#include "SparseMatrixTest.h"
+
+#include <dash/SparseMatrix.h>
+#include <dash/Array.h>
+
+#include <vector>
+
+
+TEST_F(SparseMatrixTest, ConstructFromEntries)
+{
+  typedef dash::SparseMatrix<double> matrix_t;
+  typedef matrix_t::entry_type       entry_t;
+  typedef matrix_t::index_type       index_t;
+
+  index_t n = 8 * _dash_size;
+
+  // Every unit specifies the tridiagonal rows r with r % nunits == myid,
+  // which are owned by other units, and an entry at (0,0):
+  std::vector<entry_t> entries;
+  for (index_t r = _dash_id; r < n; r += _dash_size) {
+    if (r > 0) {
+      entries.push_back(entry_t { r, r - 1, -1.0 });
+    }
+    entries.push_back(entry_t { r, r, 2.0 });
+    if (r < n - 1) {
+      entries.push_back(entry_t { r, r + 1, -1.0 });
+    }
+  }
+  entries.push_back(entry_t { 0, 0, 1.0 });
+
+  matrix_t matrix(n, n, entries);
+
+  EXPECT_EQ_U(n,         matrix.nrows());
+  EXPECT_EQ_U(n,         matrix.ncols());
+  EXPECT_EQ_U(3 * n - 2, matrix.nnz());
+
+  dash::Array<double> blocked(n);
+  EXPECT_EQ_U(blocked.lsize(), matrix.local_nrows());
+
+  const auto & row_ptr = matrix.local_row_ptr();
+  const auto & cols    = matrix.local_col_indices();
+  const auto & values  = matrix.local_values();
+  ASSERT_EQ_U(matrix.local_nrows() + 1, row_ptr.size());
+  EXPECT_EQ_U(matrix.local_nnz(), row_ptr.back());
+  for (index_t lrow = 0;
+       lrow < static_cast<index_t>(matrix.local_nrows());
+       ++lrow) {
+    index_t row = matrix.pattern().global(lrow);
+    auto    k   = row_ptr[lrow];
+    if (row > 0) {
+      EXPECT_EQ_U(row - 1, cols[k]);
+      EXPECT_EQ_U(-1.0,    values[k]);
+      ++k;
+    }
+    EXPECT_EQ_U(row, cols[k]);
+    EXPECT_EQ_U(row == 0 ? 2.0 + _dash_size : 2.0, values[k]);
+    ++k;
+    if (row < n - 1) {
+      EXPECT_EQ_U(row + 1, cols[k]);
+      EXPECT_EQ_U(-1.0,    values[k]);
+      ++k;
+    }
+    EXPECT_EQ_U(row_ptr[lrow + 1], k);
+  }
+}
+
+TEST_F(SparseMatrixTest, MultiplyTridiagonal)
+{
+  typedef dash::SparseMatrix<double> matrix_t;
+  typedef matrix_t::entry_type       entry_t;
+  typedef matrix_t::index_type       index_t;
+
+  index_t n = 10 * _dash_size;
+
+  std::vector<entry_t> entries;
+  if (_dash_id == 0) {
+    for (index_t r = 0; r < n; ++r) {
+      if (r > 0) {
+        entries.push_back(entry_t { r, r - 1, -1.0 });
+      }
+      entries.push_back(entry_t { r, r, 2.0 });
+      if (r < n - 1) {
+        entries.push_back(entry_t { r, r + 1, -1.0 });
+      }
+    }
+  }
+  matrix_t matrix(n, n, entries);
+
+  dash::Array<double> x(n);
+  dash::Array<double> y(n);
+
+  for (size_t l = 0; l < x.lsize(); ++l) {
+    x.local[l] = static_cast<double>(x.pattern().global(l));
+  }
+  matrix.multiply(x, y);
+  y.barrier();
+
+  for (index_t i = 0; i < n; ++i) {
+    double expected = (i == 0) ? -1.0 : (i == n - 1) ? n : 0.0;
+    EXPECT_EQ_U(expected, static_cast<double>(y[i]));
+  }
+  y.barrier();
+
+  // Repeated product with modified vector elements:
+  for (size_t l = 0; l < x.lsize(); ++l) {
+    double gi   = static_cast<double>(x.pattern().global(l));
+    x.local[l]  = gi * gi;
+  }
+  matrix.multiply(x, y);
+  y.barrier();
+
+  for (index_t i = 0; i < n; ++i) {
+    double di       = i;
+    double expected = 2 * di * di;
+    if (i > 0)     { expected -= (di - 1) * (di - 1); }
+    if (i < n - 1) { expected -= (di + 1) * (di + 1); }
+    EXPECT_EQ_U(expected, static_cast<double>(y[i]));
+  }
+}
+
+TEST_F(SparseMatrixTest, MultiplyIrregularDistribution)
+{
+  typedef dash::SparseMatrix<double>  matrix_t;
+  typedef matrix_t::entry_type        entry_t;
+  typedef matrix_t::index_type        index_t;
+  typedef matrix_t::size_type         extent_t;
+  typedef matrix_t::pattern_type      pattern_t;
+
+  std::vector<extent_t> local_rows;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    local_rows.push_back((u + 1) * 3);
+  }
+  pattern_t row_pattern(local_rows);
+  index_t   nrows = row_pattern.size();
+  index_t   ncols = 7 * _dash_size + 3;
+
+  // Two entries per row at scattered columns, coinciding for some rows:
+  auto col_a = [&](index_t r) { return (r * 7) % ncols; };
+  auto col_b = [&](index_t r) { return (r * 3 + ncols / 2) % ncols; };
+  std::vector<entry_t> entries;
+  for (index_t r = _dash_id; r < nrows; r += _dash_size) {
+    entries.push_back(entry_t { r, col_a(r), 1.0 });
+    entries.push_back(entry_t { r, col_b(r), 0.5 });
+  }
+  matrix_t matrix(row_pattern, ncols, entries);
+
+  dash::Array<double> x(ncols, dash::BLOCKCYCLIC(2));
+  dash::Array<double, index_t, pattern_t> y(row_pattern);
+
+  for (size_t l = 0; l < x.lsize(); ++l) {
+    x.local[l] = static_cast<double>(x.pattern().global(l) + 1);
+  }
+  matrix.multiply(x, y);
+  y.barrier();
+
+  for (index_t r = 0; r < nrows; ++r) {
+    double expected = 1.0 * (col_a(r) + 1) + 0.5 * (col_b(r) + 1);
+    EXPECT_EQ_U(expected, static_cast<double>(y[r]));
+  }
+}
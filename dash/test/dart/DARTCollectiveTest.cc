@@ -2,6 +2,7 @@
 #include "DARTCollectiveTest.h"
 
 #include <dash/dart/if/dart.h>
+#include <dash/Future.h>
 
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
@@ -52,6 +53,58 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
 }
 
 
+TEST_F(DARTCollectiveTest, ISend_IRecv) {
+  // every unit sends to its right and receives from its left neighbor
+  dart_global_unit_t right = DART_GLOBAL_UNIT_ID(
+                               (_dash_id + 1) % _dash_size);
+  dart_global_unit_t left  = DART_GLOBAL_UNIT_ID(
+                               (_dash_id + _dash_size - 1) % _dash_size);
+
+  int send = _dash_id;
+  int recv = -1;
+  dart_handle_t handles[2];
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_irecv(&recv, 1, DART_TYPE_INT, 0, left, &handles[0]));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_isend(&send, 1, DART_TYPE_INT, 0, right, &handles[1]));
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles, 2));
+  ASSERT_EQ_U(left.id, recv);
+  ASSERT_EQ_U(DART_HANDLE_NULL, handles[0]);
+  ASSERT_EQ_U(DART_HANDLE_NULL, handles[1]);
+
+  // wrap the receive in a future
+  dart_handle_t send_handle;
+  dart_handle_t recv_handle;
+  send = 100 + _dash_id;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_irecv(&recv, 1, DART_TYPE_INT, 1, left, &recv_handle));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_isend(&send, 1, DART_TYPE_INT, 1, right, &send_handle));
+  dash::Future<int> fut(
+    [&]() {
+      dart_wait_local(&recv_handle);
+      return recv;
+    },
+    [&](int * value) {
+      int32_t flag;
+      dart_test_local(&recv_handle, &flag);
+      if (flag) {
+        *value = recv;
+      }
+      return (flag != 0);
+    },
+    [&]() {
+      dart_handle_free(&recv_handle);
+    });
+  while (!fut.test()) { }
+  ASSERT_EQ_U(100 + left.id, fut.get());
+  ASSERT_EQ_U(DART_OK, dart_wait(&send_handle));
+}
+
 TEST_F(DARTCollectiveTest, MinMax) {
 
   using elem_t = int;
@@ -104,6 +157,37 @@ TEST_F(DARTCollectiveTest, MinMaxInt64t) {
 
 }
 
+TEST_F(DARTCollectiveTest, Exscan) {
+
+  using elem_t = size_t;
+
+  // Every unit contributes its id and its id squared:
+  elem_t myid = dash::myid();
+  std::array<elem_t, 2> in{myid, myid * myid};
+  std::array<elem_t, 2> out{};
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_exscan(
+      in.data(),                          // send buffer
+      out.data(),                         // receive buffer
+      2,                                  // buffer size
+      dash::dart_datatype<elem_t>::value, // data type
+      DART_OP_SUM,                        // operation
+      dash::Team::All().dart_id()         // team
+      ));
+
+  // Result at unit 0 is undefined:
+  if (myid > 0) {
+    elem_t sum = 0, sum_sq = 0;
+    for (elem_t u = 0; u < myid; ++u) {
+      sum    += u;
+      sum_sq += u * u;
+    }
+    ASSERT_EQ_U(sum,    out[0]);
+    ASSERT_EQ_U(sum_sq, out[1]);
+  }
+}
+
 template<typename T>
 static void reduce_max_fn(
   const void   *invec_,
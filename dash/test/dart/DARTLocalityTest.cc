@@ -192,6 +192,48 @@ TEST_F(DARTLocalityTest, UnitLocality)
   EXPECT_EQ_U(dl->scope, DART_LOCALITY_SCOPE_CORE);
 }
 
+TEST_F(DARTLocalityTest, LazyTeamLocality)
+{
+  // Hardware locality of the calling unit is available without
+  // exchanging locality information:
+  const dart_hwinfo_t * hw;
+  ASSERT_EQ_U(DART_OK, dart_unit_hwinfo(&hw));
+  ASSERT_NE_U(nullptr, hw);
+  EXPECT_NE_U(hw->num_cores, 0);
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  auto & split_team = dash::Team::All().split(2);
+  ASSERT_GT_U(split_team.size(), 0);
+
+  // Locality information of the new team is created on first query,
+  // collectively at all units in the team:
+  dart_domain_locality_t * team_domain;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_domain_team_locality(split_team.dart_id(), ".", &team_domain));
+  EXPECT_EQ_U(split_team.size(), team_domain->num_units);
+
+  dart_unit_locality_t * ul;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_unit_locality(split_team.dart_id(), split_team.myid(), &ul));
+  EXPECT_EQ_U(split_team.myid().id, ul->unit.id);
+  EXPECT_STREQ(hw->host, ul->hwinfo.host);
+
+  // Explicit initialization of existing locality information is a no-op:
+  EXPECT_EQ_U(DART_OK, dart_team_locality_init(split_team.dart_id()));
+  dart_domain_locality_t * team_domain_2;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_domain_team_locality(split_team.dart_id(), ".", &team_domain_2));
+  EXPECT_EQ_U(team_domain, team_domain_2);
+
+  split_team.barrier();
+}
+
 TEST_F(DARTLocalityTest, Domains)
 {
   DASH_LOG_TRACE("DARTLocalityTest.Domains",
@@ -171,6 +171,183 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
 }
 
 
+TEST_F(DARTMemAllocTest, RegisterCacheTest)
+{
+  const size_t block_size = 10;
+  std::vector<int> buf(block_size, dash::myid().id);
+  std::vector<int> other(block_size, dash::myid().id + 1);
+
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister_persistent(
+      DART_TEAM_ALL, block_size, DART_TYPE_INT, buf.data(), &gptr));
+  int16_t segid = gptr.segid;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memderegister(gptr));
+
+  // re-registering the same memory range is served from the cache
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister_persistent(
+      DART_TEAM_ALL, block_size, DART_TYPE_INT, buf.data(), &gptr));
+  ASSERT_EQ_U(segid, gptr.segid);
+
+  // a different memory range receives a new segment
+  dart_gptr_t gptr2;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister_persistent(
+      DART_TEAM_ALL, block_size, DART_TYPE_INT, other.data(), &gptr2));
+  ASSERT_NE_U(segid, gptr2.segid);
+
+  // a range overlapping a cached registration in use is rejected at all
+  // units, also if it overlaps at a single unit only
+  std::vector<int> third(block_size);
+  int * overlapping = (dash::myid() == 0) ? buf.data() + 1 : third.data();
+  dart_gptr_t gptr3;
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_team_memregister_persistent(
+      DART_TEAM_ALL, block_size / 2, DART_TYPE_INT, overlapping, &gptr3));
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_team_memregister(
+      DART_TEAM_ALL, block_size / 2, DART_TYPE_INT, overlapping, &gptr3));
+
+  dash::barrier();
+
+  // the cached registration is still accessible by remote units
+  dart_team_unit_t neighbor{static_cast<dart_unit_t>(
+                              (dash::myid() + 1) % dash::size())};
+  dart_gptr_setunit(&gptr, neighbor);
+  std::vector<int> recv(block_size);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+      recv.data(), gptr, block_size, DART_TYPE_INT, DART_TYPE_INT));
+  for (size_t i = 0; i < block_size; ++i) {
+    ASSERT_EQ_U(neighbor.id, recv[i]);
+  }
+
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memderegister(gptr));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memderegister(gptr2));
+
+  // a range hitting the cache at some units only is registered anew
+  int * partial = (dash::myid() % 2 == 0) ? buf.data() : third.data();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister_persistent(
+      DART_TEAM_ALL, block_size, DART_TYPE_INT, partial, &gptr3));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memderegister(gptr3));
+
+  // unused cached registrations overlapping a plain registration are
+  // detached
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister(
+      DART_TEAM_ALL, block_size / 2, DART_TYPE_INT, buf.data() + 1, &gptr3));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memderegister(gptr3));
+
+  // detach the cached registrations before their memory is released
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister_flush(DART_TEAM_ALL));
+}
+
+TEST_F(DARTMemAllocTest, DirectAddressTest)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(
+      DART_TEAM_ALL, block_size, DART_TYPE_INT, &gptr));
+  dart_gptr_setunit(&gptr, dash::Team::All().myid());
+
+  // inline address resolution is consistent with dart_gptr_getaddr
+  value_t *addr;
+  value_t *fast_addr;
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&addr));
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr_fast(gptr, (void**)&fast_addr));
+  ASSERT_EQ_U(addr, fast_addr);
+  ASSERT_EQ_U(addr, dart_gptr_getaddr_direct(gptr));
+  for (size_t i = 0; i < block_size; ++i) {
+    addr[i] = dash::myid().id;
+  }
+
+  dash::barrier();
+
+  // node-local memory of the neighbor is either accessed directly or
+  // requires communication
+  dart_team_unit_t neighbor{static_cast<dart_unit_t>(
+                              (dash::myid() + 1) % dash::size())};
+  dart_gptr_t ngptr = gptr;
+  dart_gptr_setunit(&ngptr, neighbor);
+  value_t *naddr = static_cast<value_t *>(dart_gptr_getaddr_direct(ngptr));
+  if (naddr != nullptr) {
+    for (size_t i = 0; i < block_size; ++i) {
+      ASSERT_EQ_U(neighbor.id, naddr[i]);
+    }
+  }
+
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memfree(gptr));
+  // base addresses of freed segments are no longer resolved
+  ASSERT_EQ_U(nullptr, dart_gptr_getaddr_direct(gptr));
+}
+
+TEST_F(DARTMemAllocTest, RegisterReleasedMemoryTest)
+{
+  const size_t block_size = 10;
+  dart_gptr_t  gptr;
+  for (int iter = 0; iter < 3; ++iter) {
+    // the memory is released after every iteration and may be reused at
+    // the same address, it must not stay attached after deregistration
+    std::vector<int> buf(block_size * (iter + 1), dash::myid().id + iter);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memregister(
+        DART_TEAM_ALL, buf.size(), DART_TYPE_INT, buf.data(), &gptr));
+
+    dash::barrier();
+
+    dart_team_unit_t neighbor{static_cast<dart_unit_t>(
+                                (dash::myid() + 1) % dash::size())};
+    dart_gptr_setunit(&gptr, neighbor);
+    std::vector<int> recv(buf.size());
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(
+        recv.data(), gptr, recv.size(), DART_TYPE_INT, DART_TYPE_INT));
+    for (size_t i = 0; i < recv.size(); ++i) {
+      ASSERT_EQ_U(neighbor.id + iter, recv[i]);
+    }
+
+    dash::barrier();
+
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memderegister(gptr));
+  }
+}
+
 TEST_F(DARTMemAllocTest, AllocatorSimpleTest)
 {
   dart_allocator_t allocator;
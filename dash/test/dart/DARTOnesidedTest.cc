@@ -596,3 +596,74 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+template <typename T>
+static void test_atomic_ops()
+{
+  const dart_datatype_t dtype = dash::dart_datatype<T>::value;
+  const size_t          nunits = dash::size();
+
+  dart_gptr_t gptr;
+  T *local_ptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(DART_TEAM_ALL, 3, dtype, &gptr));
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  local_ptr[0] = 0;
+  local_ptr[1] = 0;
+  local_ptr[2] = 1;
+  dash::barrier();
+
+  // every unit accumulates on the values of unit 0
+  dart_gptr_t target = gptr;
+  target.unitid = 0;
+  T value = static_cast<T>(dash::myid() + 1);
+  ASSERT_EQ_U(DART_OK, dart_accumulate(target, &value, 1, dtype, DART_OP_SUM));
+  dart_gptr_incaddr(&target, sizeof(T));
+  ASSERT_EQ_U(DART_OK, dart_accumulate(target, &value, 1, dtype, DART_OP_MAX));
+  dart_gptr_incaddr(&target, sizeof(T));
+  ASSERT_EQ_U(DART_OK, dart_accumulate(target, &value, 1, dtype, DART_OP_PROD));
+  ASSERT_EQ_U(DART_OK, dart_flush(target));
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    T factorial = 1;
+    for (size_t u = 1; u <= nunits; ++u) {
+      factorial *= static_cast<T>(u);
+    }
+    EXPECT_EQ_U(static_cast<T>(nunits * (nunits + 1) / 2), local_ptr[0]);
+    EXPECT_EQ_U(static_cast<T>(nunits), local_ptr[1]);
+    EXPECT_EQ_U(factorial, local_ptr[2]);
+    local_ptr[0] = 0;
+  }
+  dash::barrier();
+
+  // every unit fetches a distinct intermediate sum
+  target = gptr;
+  target.unitid = 0;
+  T one = 1;
+  T fetched;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_fetch_and_op(target, &one, &fetched, dtype, DART_OP_SUM));
+  EXPECT_GE_U(fetched, static_cast<T>(0));
+  EXPECT_LT_U(fetched, static_cast<T>(nunits));
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    EXPECT_EQ_U(static_cast<T>(nunits), local_ptr[0]);
+  }
+  dash::barrier();
+
+  gptr.unitid = 0;
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+}
+
+TEST_F(DARTOnesidedTest, AtomicOpsBasicTypes)
+{
+  test_atomic_ops<int>();
+  test_atomic_ops<unsigned long long>();
+  test_atomic_ops<float>();
+  test_atomic_ops<double>();
+}
@@ -3,7 +3,9 @@
 
 #include <dash/Matrix.h>
 #include <dash/Algorithm.h>
+#include <dash/halo/HaloMatrixGroup.h>
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/StencilStep.h>
 
 #include <iostream>
 
@@ -1294,3 +1296,519 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMultiStencil)
 
   dash::Team::All().barrier();
 }
+
+TEST_F(HaloTest, HaloMatrixWrapperPush3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 5>;
+
+  constexpr long ext = 24;
+  constexpr long num_iterations = 5;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+  Matrix_t matrix_halo(pattern);
+
+  // asymmetric stencil with level 1, 2 and 3 regions
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2, 0, 0), StencilP_t( 0, 2, 0), StencilP_t( 0, 0,-1),
+      StencilP_t( 1,-1, 0), StencilP_t( 1, 1,-1));
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC,
+                             BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(
+      matrix_halo, HaloUpdateMode::PUSH, bound_spec, stencil_spec);
+  EXPECT_EQ_U(HaloUpdateMode::PUSH, halo_wrapper.update_mode());
+
+  const auto& offsets = matrix_halo.local.offsets();
+  const auto& extents = matrix_halo.local.extents();
+  // no barriers between the iterations, units only wait for neighbors
+  for(long iter = 0; iter < num_iterations; ++iter) {
+    auto* lmem = matrix_halo.lbegin();
+    for(long i = 0; i < extents[0]; ++i) {
+      for(long j = 0; j < extents[1]; ++j) {
+        for(long k = 0; k < extents[2]; ++k, ++lmem) {
+          *lmem = iter * ext * ext * ext
+                  + ((offsets[0] + i) * ext + offsets[1] + j) * ext
+                  + offsets[2] + k;
+        }
+      }
+    }
+
+    halo_wrapper.update();
+
+    auto& halo_memory = halo_wrapper.halo_memory();
+    for(const auto& region : halo_wrapper.halo_block().halo_regions()) {
+      if(region.size() == 0)
+        continue;
+
+      auto it_mem = halo_memory.first_element_at(region.index());
+      for(auto it = region.begin(); it != region.end(); ++it, ++it_mem) {
+        auto coords = it.gcoords();
+        EXPECT_EQ_U(iter * ext * ext * ext
+                      + (coords[0] * ext + coords[1]) * ext + coords[2],
+                    *it_mem);
+      }
+    }
+  }
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperMultiStep2D)
+{
+  using Pattern_t = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using Matrix_t = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 4>;
+  using RCoords_t = RegionCoords<2>;
+
+  constexpr long ext = 32;
+  constexpr long num_steps = 3;
+  constexpr long num_updates = 2;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+  Matrix_t matrix(pattern);
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1, 0), StencilP_t(1, 0), StencilP_t(0, -1),
+      StencilP_t(0, 1));
+  MultiStepStencilSpec<StencilSpec_t> steps_spec(stencil_spec, num_steps);
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix, bound_spec, steps_spec);
+
+  const auto& halo_spec = halo_wrapper.halo_block().halo_spec();
+  EXPECT_EQ_U(num_steps,
+              halo_spec.extent(RCoords_t::index(0, RegionPos::PRE)));
+  EXPECT_EQ_U(num_steps,
+              halo_spec.extent(RCoords_t::index(1, RegionPos::POST)));
+  EXPECT_EQ_U(num_steps - 1, halo_spec.extent(RCoords_t(0, 0).index()));
+
+  std::vector<long> reference(ext * ext);
+  for(long i = 0; i < ext * ext; ++i)
+    reference[i] = (i * 7) % 1000;
+
+  const auto& offsets = matrix.local.offsets();
+  const auto& extents = matrix.local.extents();
+  auto* lmem = matrix.lbegin();
+  for(long i = 0; i < extents[0]; ++i) {
+    for(long j = 0; j < extents[1]; ++j, ++lmem)
+      *lmem = reference[(offsets[0] + i) * ext + offsets[1] + j];
+  }
+  dash::Team::All().barrier();
+
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  auto op = [](long* center, long* center_dst, index_type offset,
+               const typename decltype(stencil_op)::StencilOffsets_t& offs) {
+    *center_dst = (*center + center[offs[0]] + center[offs[1]]
+                   + center[offs[2]] + center[offs[3]]) % 1000;
+  };
+
+  std::vector<long> result(matrix.local.size());
+  for(long update = 0; update < num_updates; ++update) {
+    halo_wrapper.update();
+    stencil_op.update_steps(num_steps, result.data(), op);
+
+    for(long step = 0; step < num_steps; ++step) {
+      auto next = reference;
+      for(long i = 1; i < ext - 1; ++i) {
+        for(long j = 0; j < ext; ++j) {
+          next[i * ext + j] = (reference[i * ext + j]
+                               + reference[(i - 1) * ext + j]
+                               + reference[(i + 1) * ext + j]
+                               + reference[i * ext + (j + ext - 1) % ext]
+                               + reference[i * ext + (j + 1) % ext]) % 1000;
+        }
+      }
+      reference = std::move(next);
+    }
+
+    auto it_result = result.begin();
+    for(long i = 0; i < extents[0]; ++i) {
+      for(long j = 0; j < extents[1]; ++j, ++it_result) {
+        EXPECT_EQ_U(reference[(offsets[0] + i) * ext + offsets[1] + j],
+                    *it_result);
+      }
+    }
+
+    dash::Team::All().barrier();
+    std::copy(result.begin(), result.end(), matrix.lbegin());
+    dash::Team::All().barrier();
+  }
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperMultiStepTiled2D)
+{
+  using Pattern_t = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using Matrix_t = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 5>;
+
+  constexpr long ext = 40;
+  constexpr long num_steps = 4;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+  Matrix_t matrix(pattern);
+
+  // asymmetric stencil, the tiles are skewed by the larger radius
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2, 0), StencilP_t(1, 0), StencilP_t(0, -1),
+      StencilP_t(0, 1), StencilP_t(1, 1));
+  MultiStepStencilSpec<StencilSpec_t> steps_spec(stencil_spec, num_steps);
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix, bound_spec, steps_spec);
+
+  const auto& offsets = matrix.local.offsets();
+  const auto& extents = matrix.local.extents();
+  auto* lmem = matrix.lbegin();
+  for(long i = 0; i < extents[0]; ++i) {
+    for(long j = 0; j < extents[1]; ++j, ++lmem)
+      *lmem = (((offsets[0] + i) * ext + offsets[1] + j) * 7) % 1000;
+  }
+  dash::Team::All().barrier();
+  halo_wrapper.update();
+
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  auto op = [](long* center, long* center_dst, index_type offset,
+               const typename decltype(stencil_op)::StencilOffsets_t& offs) {
+    *center_dst = (*center + 2 * center[offs[0]] + center[offs[1]]
+                   + 3 * center[offs[2]] + center[offs[3]]
+                   + center[offs[4]]) % 1000;
+  };
+
+  std::vector<long> reference(matrix.local.size());
+  stencil_op.update_steps(num_steps, reference.data(), op);
+
+  for(long tile_extent : { 1, 2, 5, 64, 0 }) {
+    std::vector<long> result(matrix.local.size());
+    stencil_op.update_steps_tiled(num_steps, result.data(), op, tile_extent);
+    for(std::size_t i = 0; i < result.size(); ++i)
+      EXPECT_EQ_U(reference[i], result[i]);
+  }
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperInnerBulk3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<double, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 7>;
+
+  constexpr long ext = 20;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+  Matrix_t matrix(pattern);
+
+  // asymmetric stencil with distinct coefficients
+  StencilSpec_t stencil_spec(
+      StencilP_t(0.5, -1, 0, 0), StencilP_t(0.25, 1, 0, 0),
+      StencilP_t(0.125, 0, -2, 0), StencilP_t(2.0, 0, 1, 0),
+      StencilP_t(-0.5, 0, 0, -1), StencilP_t(1.5, 0, 0, 1),
+      StencilP_t(0.75, 1, -1, 1));
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC,
+                             BoundaryProp::NONE);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix, bound_spec, stencil_spec);
+
+  const auto& offsets = matrix.local.offsets();
+  const auto& extents = matrix.local.extents();
+  auto* lmem = matrix.lbegin();
+  for(long i = 0; i < extents[0]; ++i) {
+    for(long j = 0; j < extents[1]; ++j) {
+      for(long k = 0; k < extents[2]; ++k, ++lmem) {
+        *lmem = (((offsets[0] + i) * ext + offsets[1] + j) * ext
+                 + offsets[2] + k) % 97;
+      }
+    }
+  }
+  dash::Team::All().barrier();
+
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  constexpr double coefficient_center = -3.0;
+  std::vector<double> result(matrix.local.size(), -1.0);
+  stencil_op.inner.update(result.data(), coefficient_center,
+                          std::plus<double>());
+
+  const auto& inner_view = stencil_op.inner.view();
+  std::size_t num_inner = 0;
+  for(long i = 0; i < extents[0]; ++i) {
+    for(long j = 0; j < extents[1]; ++j) {
+      for(long k = 0; k < extents[2]; ++k) {
+        auto value = result[(i * extents[1] + j) * extents[2] + k];
+        bool is_inner =
+          i >= inner_view.offset(0)
+          && i < inner_view.offset(0) + inner_view.extent(0)
+          && j >= inner_view.offset(1)
+          && j < inner_view.offset(1) + inner_view.extent(1)
+          && k >= inner_view.offset(2)
+          && k < inner_view.offset(2) + inner_view.extent(2);
+        if(!is_inner) {
+          // non-inner elements are not touched
+          EXPECT_EQ_U(-1.0, value);
+          continue;
+        }
+        ++num_inner;
+        EXPECT_DOUBLE_EQ(
+          stencil_op.inner.get_value_at({ i, j, k }, coefficient_center),
+          value);
+      }
+    }
+  }
+  EXPECT_EQ_U(inner_view.size(), num_inner);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperStencilStep2D)
+{
+  using Pattern_t = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using Matrix_t = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 5>;
+
+  constexpr long ext = 30;
+  constexpr long num_steps = 4;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+
+  // asymmetric stencil with a corner point
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1, 0), StencilP_t(2, 0), StencilP_t(0, -1),
+      StencilP_t(0, 1), StencilP_t(1, -1));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC);
+
+  auto kernel = [](auto& it) {
+    return (*it + it.value_at(0) + it.value_at(1) + it.value_at(2)
+            + it.value_at(3) + it.value_at(4)) % 1000;
+  };
+
+  for(auto mode : { HaloUpdateMode::PULL, HaloUpdateMode::PUSH }) {
+    Matrix_t matrix_first(pattern);
+    Matrix_t matrix_second(pattern);
+    HaloDoubleBuffer<Matrix_t, StencilSpec_t> buffer(
+      matrix_first, matrix_second, mode, bound_spec, stencil_spec);
+
+    std::vector<long> reference(ext * ext);
+    for(long i = 0; i < ext * ext; ++i)
+      reference[i] = (i * 13) % 1000;
+
+    const auto& offsets = matrix_first.local.offsets();
+    const auto& extents = matrix_first.local.extents();
+    auto* lmem = matrix_first.lbegin();
+    for(long i = 0; i < extents[0]; ++i) {
+      for(long j = 0; j < extents[1]; ++j, ++lmem)
+        *lmem = reference[(offsets[0] + i) * ext + offsets[1] + j];
+    }
+    dash::Team::All().barrier();
+
+    for(long step = 0; step < num_steps; ++step) {
+      stencil_step(buffer, kernel);
+
+      auto next = reference;
+      for(long i = 0; i < ext; ++i) {
+        for(long j = 0; j < ext; ++j) {
+          auto at = [&reference](long x, long y) {
+            return reference[((x + ext) % ext) * ext + (y + ext) % ext];
+          };
+          next[i * ext + j] = (at(i, j) + at(i - 1, j) + at(i + 2, j)
+                               + at(i, j - 1) + at(i, j + 1)
+                               + at(i + 1, j - 1)) % 1000;
+        }
+      }
+      reference = std::move(next);
+
+      auto* result = buffer.matrix().lbegin();
+      for(long i = 0; i < extents[0]; ++i) {
+        for(long j = 0; j < extents[1]; ++j, ++result) {
+          EXPECT_EQ_U(reference[(offsets[0] + i) * ext + offsets[1] + j],
+                      *result);
+        }
+      }
+    }
+    EXPECT_EQ_U((num_steps % 2 == 0) ? matrix_first.lbegin()
+                                     : matrix_second.lbegin(),
+                buffer.matrix().lbegin());
+
+    dash::Team::All().barrier();
+  }
+}
+
+TEST_F(HaloTest, HaloMatrixGroup2D)
+{
+  using Pattern_t = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using Matrix_t = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 5>;
+
+  constexpr long ext = 28;
+  constexpr long num_fields = 3;
+  constexpr long num_iterations = 4;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+
+  std::vector<std::unique_ptr<Matrix_t>> fields;
+  std::vector<Matrix_t*> matrices;
+  for(long f = 0; f < num_fields; ++f) {
+    fields.emplace_back(new Matrix_t(pattern));
+    matrices.push_back(fields.back().get());
+  }
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2, 0), StencilP_t(1, 0), StencilP_t(0, -1),
+      StencilP_t(0, 2), StencilP_t(-1, 1));
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC);
+  HaloMatrixGroup<Matrix_t> halo_group(matrices, bound_spec, stencil_spec);
+  EXPECT_EQ_U(num_fields, halo_group.size());
+
+  const auto& offsets = fields.front()->local.offsets();
+  const auto& extents = fields.front()->local.extents();
+  auto value = [](long iter, long f, long x, long y) {
+    return ((iter * num_fields + f) * ext + x) * ext + y;
+  };
+  // no barriers between the iterations besides the one of the update
+  for(long iter = 0; iter < num_iterations; ++iter) {
+    for(long f = 0; f < num_fields; ++f) {
+      auto* lmem = fields[f]->lbegin();
+      for(long i = 0; i < extents[0]; ++i) {
+        for(long j = 0; j < extents[1]; ++j, ++lmem)
+          *lmem = value(iter, f, offsets[0] + i, offsets[1] + j);
+      }
+    }
+
+    halo_group.update();
+
+    for(long f = 0; f < num_fields; ++f) {
+      auto& halo_wrapper = halo_group[f];
+      auto& halo_memory = halo_wrapper.halo_memory();
+      for(const auto& region : halo_wrapper.halo_block().halo_regions()) {
+        if(region.size() == 0)
+          continue;
+
+        auto it_mem = halo_memory.first_element_at(region.index());
+        for(auto it = region.begin(); it != region.end(); ++it, ++it_mem) {
+          auto coords = it.gcoords();
+          EXPECT_EQ_U(value(iter, f, coords[0], coords[1]), *it_mem);
+        }
+      }
+    }
+  }
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperPushPacked2D)
+{
+  using Pattern_t = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using Matrix_t = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 4>;
+
+  constexpr long halo_width = 36;
+  constexpr long num_iterations = 3;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  const long ext_0 = 4 * team_spec.extent(0);
+  const long ext_1 = (halo_width + 4) * team_spec.extent(1);
+  Pattern_t pattern(SizeSpec_t(ext_0, ext_1), dist_spec, team_spec,
+                    dash::Team::All());
+  Matrix_t matrix_halo(pattern);
+
+  // narrow halo regions in dimension 0 are pushed as contiguous blocks,
+  // wide ones in dimension 1 with a strided datatype and corners packed
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1, 0), StencilP_t(0, halo_width), StencilP_t(0, -1),
+      StencilP_t(1, 1));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(
+      matrix_halo, HaloUpdateMode::PUSH, bound_spec, stencil_spec);
+
+  const auto& offsets = matrix_halo.local.offsets();
+  const auto& extents = matrix_halo.local.extents();
+  for(long iter = 0; iter < num_iterations; ++iter) {
+    auto* lmem = matrix_halo.lbegin();
+    for(long i = 0; i < extents[0]; ++i) {
+      for(long j = 0; j < extents[1]; ++j, ++lmem) {
+        *lmem = (iter * ext_0 + offsets[0] + i) * ext_1 + offsets[1] + j;
+      }
+    }
+
+    halo_wrapper.update();
+
+    auto& halo_memory = halo_wrapper.halo_memory();
+    for(const auto& region : halo_wrapper.halo_block().halo_regions()) {
+      if(region.size() == 0)
+        continue;
+
+      auto it_mem = halo_memory.first_element_at(region.index());
+      for(auto it = region.begin(); it != region.end(); ++it, ++it_mem) {
+        auto coords = it.gcoords();
+        EXPECT_EQ_U((iter * ext_0 + coords[0]) * ext_1 + coords[1],
+                    *it_mem);
+      }
+    }
+  }
+
+  dash::Team::All().barrier();
+}
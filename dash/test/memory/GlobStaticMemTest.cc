@@ -3,6 +3,13 @@
 #include <dash/allocator/GlobalAllocator.h>
 #include <dash/memory/UniquePtr.h>
 
+#ifdef DASH_ENABLE_NUMA
+#include <numa.h>
+#include <numaif.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 TEST_F(GlobStaticMemTest, GlobalRandomAccess)
 {
   auto globmem_local_elements = {1, 2, 3};
@@ -316,6 +323,131 @@ TEST_F(GlobStaticMemTest, HBWSpaceTest)
   alloc.deallocate(gptr, 10);
 }
 
+#ifdef DASH_ENABLE_NUMA
+/**
+ * Returns the NUMA policy of the page containing \c addr or -1 if NUMA
+ * policies are not supported.
+ */
+static int page_mempolicy(void * addr)
+{
+  int mode;
+  if (numa_available() < 0 ||
+      get_mempolicy(&mode, nullptr, 0, addr, MPOL_F_ADDR) != 0) {
+    return -1;
+  }
+  return mode;
+}
+
+/**
+ * Returns the first address in [\c addr, \c addr + \c bytes) at the
+ * beginning of a full page or \c nullptr if the range contains no full
+ * page.
+ */
+static void * first_full_page(void * addr, size_t bytes)
+{
+  uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  uintptr_t begin     = reinterpret_cast<uintptr_t>(addr);
+  uintptr_t page      = (begin + page_size - 1) & ~(page_size - 1);
+  return (page + page_size <= begin + bytes)
+         ? reinterpret_cast<void *>(page)
+         : nullptr;
+}
+#endif
+
+TEST_F(GlobStaticMemTest, NUMAPlacement)
+{
+  using value_t     = int;
+  constexpr size_t nlelem = 4096;
+
+  {
+    using memory_t    = dash::GlobStaticMem<dash::HostSpace>;
+    using allocator_t = dash::GlobalAllocator<value_t, memory_t>;
+
+    dash::HostSpace space{dash::numa_policy::interleaved};
+    ASSERT_EQ_U(dash::numa_policy::interleaved, space.policy());
+
+    memory_t    memory{&space, dash::Team::All()};
+    allocator_t alloc{&memory};
+
+    auto const gptr = alloc.allocate(nlelem);
+    EXPECT_TRUE_U(gptr);
+
+    auto *lbegin = dash::local_begin(gptr, dash::Team::All().myid());
+    std::fill(lbegin, lbegin + nlelem, dash::myid().id);
+    dash::barrier();
+
+    EXPECT_EQ_U(dash::myid().id, lbegin[0]);
+    EXPECT_EQ_U(dash::myid().id, lbegin[nlelem - 1]);
+#ifdef DASH_ENABLE_NUMA
+    auto *page = first_full_page(lbegin, nlelem * sizeof(value_t));
+    if (page != nullptr && page_mempolicy(page) >= 0) {
+      EXPECT_EQ_U(MPOL_INTERLEAVE, page_mempolicy(page));
+    }
+#endif
+
+    alloc.deallocate(gptr, nlelem);
+  }
+  {
+    using space_t     = dash::NUMAHostSpace<dash::numa_policy::local>;
+    using memory_t    = dash::GlobStaticMem<space_t>;
+    using allocator_t = dash::GlobalAllocator<value_t, memory_t>;
+
+    memory_t    memory{dash::Team::All()};
+    allocator_t alloc{&memory};
+
+    auto const gptr = alloc.allocate(nlelem);
+    EXPECT_TRUE_U(gptr);
+
+    auto *lbegin = dash::local_begin(gptr, dash::Team::All().myid());
+    std::fill(lbegin, lbegin + nlelem, dash::myid().id);
+    dash::barrier();
+
+    EXPECT_EQ_U(dash::myid().id, lbegin[nlelem / 2]);
+#ifdef DASH_ENABLE_NUMA
+    auto *page = first_full_page(lbegin, nlelem * sizeof(value_t));
+    if (page != nullptr && page_mempolicy(page) >= 0) {
+      EXPECT_EQ_U(MPOL_BIND, page_mempolicy(page));
+    }
+#endif
+
+    alloc.deallocate(gptr, nlelem);
+  }
+}
+
+TEST_F(GlobStaticMemTest, NUMAPlacementPartialPages)
+{
+#ifndef DASH_ENABLE_NUMA
+  SKIP_TEST_MSG("NUMA support disabled");
+#else
+  if (numa_available() < 0) {
+    SKIP_TEST_MSG("NUMA policies not supported");
+  }
+  size_t page_size = sysconf(_SC_PAGESIZE);
+
+  for (auto policy : { dash::numa_policy::interleaved,
+                       dash::numa_policy::local,
+                       dash::numa_policy::first_touch_parallel }) {
+    auto *base = static_cast<char *>(
+                   mmap(nullptr, 4 * page_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_NE_U(MAP_FAILED, static_cast<void *>(base));
+
+    // only the second page is fully contained in the placed range
+    dash::HostSpace space{policy};
+    space.place(base + 100, 3 * page_size - 200);
+
+    int mode = (policy == dash::numa_policy::interleaved)
+               ? MPOL_INTERLEAVE
+               : MPOL_BIND;
+    EXPECT_EQ_U(MPOL_DEFAULT, page_mempolicy(base));
+    EXPECT_EQ_U(mode,         page_mempolicy(base + page_size));
+    EXPECT_EQ_U(MPOL_DEFAULT, page_mempolicy(base + 2 * page_size));
+
+    munmap(base, 4 * page_size);
+  }
+#endif
+}
+
 TEST_F(GlobStaticMemTest, CopyGlobPtr)
 {
   using value_t   = int;